@@ -0,0 +1,90 @@
+#include "Arena.h"
+#include <cstdint>
+#include <cstdlib>
+
+// Blocks start with their header; data begins at the next max_align_t boundary
+static const size_t BLOCK_HEADER_BYTES = (sizeof(void*) + alignof(std::max_align_t) - 1)
+                                         & ~(alignof(std::max_align_t) - 1);
+
+Arena::Arena(size_t blockBytes)
+    : m_blockBytes(blockBytes > BLOCK_HEADER_BYTES ? blockBytes : DEFAULT_ARENA_BLOCK_BYTES),
+      m_blocks(nullptr), m_cursor(nullptr), m_end(nullptr), m_blockCount(0), m_bytesAllocated(0)
+{
+}
+
+Arena::~Arena()
+{
+    Release();
+}
+
+void Arena::addBlock(size_t bytes)
+{
+    Block* block = static_cast<Block*>(std::malloc(bytes));
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    block->next = m_blocks;
+    m_blocks = block;
+    m_blockCount++;
+}
+
+void* Arena::Allocate(size_t bytes, size_t alignment)
+{
+    if (bytes == 0)
+    {
+        bytes = 1;
+    }
+    m_bytesAllocated += bytes;
+
+    // Oversized requests get a dedicated block behind the current one, which stays in use
+    if (bytes > (m_blockBytes - BLOCK_HEADER_BYTES) / 4)
+    {
+        Block* current = m_blocks;
+        addBlock(BLOCK_HEADER_BYTES + bytes);
+        Block* dedicated = m_blocks;
+        if (current != nullptr)
+        {
+            m_blocks = current;
+            dedicated->next = current->next;
+            current->next = dedicated;
+        }
+        return reinterpret_cast<char*>(dedicated) + BLOCK_HEADER_BYTES;
+    }
+
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(m_cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    if (m_cursor == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(m_end))
+    {
+        addBlock(m_blockBytes);
+        m_cursor = reinterpret_cast<char*>(m_blocks) + BLOCK_HEADER_BYTES;
+        m_end = reinterpret_cast<char*>(m_blocks) + m_blockBytes;
+        aligned = reinterpret_cast<uintptr_t>(m_cursor); // Block data is max_align_t aligned
+    }
+
+    m_cursor = reinterpret_cast<char*>(aligned + bytes);
+    return reinterpret_cast<void*>(aligned);
+}
+
+void Arena::Release()
+{
+    while (m_blocks != nullptr)
+    {
+        Block* next = m_blocks->next;
+        std::free(m_blocks);
+        m_blocks = next;
+    }
+    m_cursor = nullptr;
+    m_end = nullptr;
+    m_blockCount = 0;
+    m_bytesAllocated = 0;
+}
+
+size_t Arena::GetBlockCount() const
+{
+    return m_blockCount;
+}
+
+size_t Arena::GetBytesAllocated() const
+{
+    return m_bytesAllocated;
+}
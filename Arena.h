@@ -0,0 +1,146 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <cstddef>
+#include <new>
+
+/// @brief Size of the blocks an Arena carves allocations from.
+const size_t DEFAULT_ARENA_BLOCK_BYTES = 1024 * 1024;
+
+/**
+ * @class Arena
+ * @brief Bump allocator: hands out memory from a few large blocks and frees them all at once.
+ *
+ * Allocate() only advances a pointer inside the current block; individual
+ * allocations are never freed, so memory given back by a container (e.g. the
+ * old array after a Vector grows) is only reclaimed by Release() or the
+ * destructor. Requests larger than a quarter of the block size get a block of
+ * their own so they do not waste the rest of the current one.
+ * Not thread safe: use one arena per thread.
+ */
+class Arena
+{
+public:
+    /**
+     * @brief Creates an empty arena. No memory is taken until the first allocation.
+     * @param blockBytes Size of each block.
+     */
+    explicit Arena(size_t blockBytes = DEFAULT_ARENA_BLOCK_BYTES);
+
+    /**
+     * @brief Destructor. Frees every block.
+     */
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Allocates uninitialised memory.
+     * @param bytes Number of bytes.
+     * @param alignment Required alignment (a power of two, at most alignof(std::max_align_t)).
+     * @return The memory; throws std::bad_alloc if no block can be allocated.
+     */
+    void* Allocate(size_t bytes, size_t alignment);
+
+    /**
+     * @brief Frees every block. Everything allocated from the arena becomes invalid.
+     */
+    void Release();
+
+    /**
+     * @brief Gets the number of blocks held.
+     * @return The block count.
+     */
+    size_t GetBlockCount() const;
+
+    /**
+     * @brief Gets the number of bytes handed out since the last Release().
+     * @return The allocated byte count (excluding alignment padding).
+     */
+    size_t GetBytesAllocated() const;
+
+private:
+    struct Block
+    {
+        Block* next; //!< Previously allocated block.
+    };
+
+    void addBlock(size_t bytes);
+
+    size_t m_blockBytes;      //!< Size of a regular block.
+    Block* m_blocks;          //!< Most recent block; each block links to the previous one.
+    char* m_cursor;           //!< Next free byte of the current block.
+    char* m_end;              //!< End of the current block.
+    size_t m_blockCount;      //!< Blocks held.
+    size_t m_bytesAllocated;  //!< Bytes handed out.
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief Standard-library style allocator that draws from an Arena.
+ *
+ * Usable with Vector, Bst and the std containers. A default-constructed
+ * ArenaAllocator has no arena and falls back to the normal heap, so containers
+ * built without one behave exactly as before. Deallocation is a no-op for
+ * arena memory; the arena must outlive every container using it.
+ */
+template <class T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    ArenaAllocator() noexcept : m_arena(nullptr) {}
+
+    /**
+     * @brief Creates an allocator drawing from the given arena (nullptr: the heap).
+     */
+    explicit ArenaAllocator(Arena* arena) noexcept : m_arena(arena) {}
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.GetArena()) {}
+
+    T* allocate(size_t count)
+    {
+        if (m_arena == nullptr)
+        {
+            return static_cast<T*>(::operator new(sizeof(T) * count));
+        }
+        return static_cast<T*>(m_arena->Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        if (m_arena == nullptr)
+        {
+            ::operator delete(p);
+        }
+    }
+
+    /**
+     * @brief Gets the arena allocations come from.
+     * @return The arena, or nullptr for the heap.
+     */
+    Arena* GetArena() const
+    {
+        return m_arena;
+    }
+
+private:
+    Arena* m_arena; //!< Source of memory, or nullptr for the heap.
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return a.GetArena() == b.GetArena();
+}
+
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return a.GetArena() != b.GetArena();
+}
+
+#endif // ARENA_H_INCLUDED
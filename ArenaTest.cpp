@@ -0,0 +1,83 @@
+#include <iostream>
+#include <cstdint>
+#include <string>
+#include "Arena.h"
+#include "Vector.h"
+#include "Bst.h"
+
+using namespace std;
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static void sumVisit(int& item, void* userData)
+{
+    *static_cast<long*>(userData) += item;
+}
+
+int main()
+{
+    cout << "--- Arena Unit Tests ---" << endl;
+
+    // 1. Small allocations share one block and respect alignment
+    cout << "\n--- Allocate Test ---" << endl;
+    Arena arena(4096);
+    char* a = static_cast<char*>(arena.Allocate(3, 1));
+    double* b = static_cast<double*>(arena.Allocate(sizeof(double), alignof(double)));
+    bool aligned = reinterpret_cast<uintptr_t>(b) % alignof(double) == 0;
+    report("Allocate Test", a != nullptr && aligned && arena.GetBlockCount() == 1 && arena.GetBytesAllocated() == 11);
+
+    // 2. A large request gets its own block and the current block stays in use
+    cout << "\n--- Large Allocation Test ---" << endl;
+    arena.Allocate(10000, 8);
+    char* c = static_cast<char*>(arena.Allocate(1, 1));
+    report("Large Allocation Test", arena.GetBlockCount() == 2 && c > a && c < a + 4096);
+
+    // 3. Release frees everything at once
+    cout << "\n--- Release Test ---" << endl;
+    arena.Release();
+    report("Release Test", arena.GetBlockCount() == 0 && arena.GetBytesAllocated() == 0);
+
+    // 4. Vector storage comes from the arena, and copies keep using it
+    cout << "\n--- Arena Vector Test ---" << endl;
+    Arena vectorArena;
+    Vector<string, ArenaAllocator<string>> words{ArenaAllocator<string>(&vectorArena)};
+    for (int i = 0; i < 100; ++i)
+    {
+        words.PushBack("word " + to_string(i));
+    }
+    Vector<string, ArenaAllocator<string>> wordsCopy(words);
+    report("Arena Vector Test", vectorArena.GetBlockCount() == 1 && wordsCopy.getCount() == 100 &&
+           wordsCopy[99] == "word 99" && wordsCopy.GetAllocator().GetArena() == &vectorArena);
+
+    // 5. Bst nodes come from the arena
+    cout << "\n--- Arena Bst Test ---" << endl;
+    Arena treeArena;
+    {
+        Bst<int, ArenaAllocator<int>> tree{ArenaAllocator<int>(&treeArena)};
+        for (int i = 0; i < 50; ++i)
+        {
+            tree.Insert((i * 37) % 50);
+        }
+        tree.DeleteNode(10);
+        long sum = 0;
+        tree.InOrder(sumVisit, &sum);
+        size_t bytes = treeArena.GetBytesAllocated();
+        report("Arena Bst Test", sum == 49 * 50 / 2 - 10 && bytes == 50 * sizeof(Node<int>) &&
+               tree.Search(10) == nullptr && treeArena.GetBlockCount() == 1);
+    }
+
+    // 6. Without an arena the allocator falls back to the heap
+    cout << "\n--- Heap Fallback Test ---" << endl;
+    Vector<int, ArenaAllocator<int>> heapVector;
+    for (int i = 0; i < 100; ++i)
+    {
+        heapVector.PushBack(i);
+    }
+    report("Heap Fallback Test", heapVector.GetAllocator().GetArena() == nullptr && heapVector[99] == 99);
+
+    cout << "\n--- End of Arena Unit Tests ---" << endl;
+    return 0;
+}
@@ -2,6 +2,12 @@
 #define BST_H_INCLUDED
 #include <stdexcept>
 #include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using std::cout;
 using std::endl;
@@ -10,11 +16,41 @@ using std::runtime_error;
 /**
  * @brief Function pointer type definition
  * C-style "visit" function pointer. It takes a reference to the data and a 'void*' for user-defined context.
+ * Every call is indirect; the traversal overloads taking a callable avoid that.
  */
 template <class T>
 using visit_t = void (*)(T& item, void* userData);
 
 
+/**
+ * @brief Key extraction for Bst: the part of an item the tree is ordered by.
+ * The default orders by the whole item. Specialise it (KeyType plus a static
+ * Get) to look items up by a bare key instead of building a probe item.
+ * KeyType only needs operator<.
+ */
+template <class T>
+struct BstKey
+{
+    typedef T KeyType;
+    static const T& Get(const T& item)
+    {
+        return item;
+    }
+};
+
+/**
+ * @enum BstBalance
+ * @brief Selects whether a Bst keeps itself balanced.
+ */
+enum class BstBalance
+{
+    None, //!< Plain BST: shape depends on insertion order (sorted input gives a list).
+    Avl   //!< AVL tree: subtree heights differ by at most one, so the height stays O(log n).
+};
+
+/// @brief Deepest path an AVL insert records (an AVL tree of height 64 has over 10^13 nodes).
+const int BST_MAX_AVL_HEIGHT = 64;
+
 /**
  * @brief Represents a node in the Binary Search Tree.
  * @tparam T The data type stored in the node.
@@ -28,6 +64,187 @@ struct Node
     Node<T> *left;
     /// @brief Pointer to the right child node.
     Node<T> *right;
+    /// @brief Pointer to the parent node (nullptr at the root); lets iterators step without a stack.
+    Node<T> *parent;
+    /// @brief Height of the subtree rooted here (1 for a leaf); only maintained by AVL trees.
+    int height;
+
+    /// @brief Creates a leaf whose data is constructed from args.
+    template <class... Args>
+    explicit Node(Args&&... args) : info(std::forward<Args>(args)...), left(nullptr), right(nullptr), parent(nullptr), height(1) {}
+};
+
+/**
+ * @class BstIterator
+ * @brief Bidirectional in-order iterator over a Bst.
+ *
+ * Steps by following child and parent links, so each step is O(1) amortised
+ * and no stack is kept. The end iterator holds no node; decrementing it moves
+ * to the largest item. Inserting or deleting other items keeps an iterator
+ * valid; deleting its own item, or moving the tree, invalidates it.
+ * @tparam IsConst true for a const_iterator.
+ */
+template <class T, bool IsConst>
+class BstIterator
+{
+public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+    typedef typename std::conditional<IsConst, const T&, T&>::type reference;
+
+    BstIterator() : m_node(nullptr), m_rootLink(nullptr) {}
+
+    /**
+     * @brief Creates an iterator at a node of the tree whose root pointer is *rootLink.
+     * @param node The node, or nullptr for the end.
+     * @param rootLink Address of the tree's root pointer (read when stepping back from the end).
+     */
+    BstIterator(Node<T>* node, Node<T>* const* rootLink) : m_node(node), m_rootLink(rootLink) {}
+
+    /// @brief Converts an iterator to a const_iterator.
+    template <bool OtherConst, class = typename std::enable_if<IsConst && !OtherConst>::type>
+    BstIterator(const BstIterator<T, OtherConst>& other) : m_node(other.GetNode()), m_rootLink(other.GetRootLink()) {}
+
+    reference operator*() const
+    {
+        return m_node->info;
+    }
+
+    pointer operator->() const
+    {
+        return &(m_node->info);
+    }
+
+    BstIterator& operator++()
+    {
+        if (m_node->right != nullptr)
+        {
+            m_node = m_node->right;
+            while (m_node->left != nullptr)
+            {
+                m_node = m_node->left;
+            }
+        }
+        else
+        {
+            // Climb until we come up from a left subtree; leaving the root makes this the end
+            Node<T>* child = m_node;
+            m_node = m_node->parent;
+            while (m_node != nullptr && child == m_node->right)
+            {
+                child = m_node;
+                m_node = m_node->parent;
+            }
+        }
+        return *this;
+    }
+
+    BstIterator operator++(int)
+    {
+        BstIterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    BstIterator& operator--()
+    {
+        if (m_node == nullptr)
+        {
+            m_node = *m_rootLink;
+            while (m_node->right != nullptr)
+            {
+                m_node = m_node->right;
+            }
+        }
+        else if (m_node->left != nullptr)
+        {
+            m_node = m_node->left;
+            while (m_node->right != nullptr)
+            {
+                m_node = m_node->right;
+            }
+        }
+        else
+        {
+            Node<T>* child = m_node;
+            m_node = m_node->parent;
+            while (m_node != nullptr && child == m_node->left)
+            {
+                child = m_node;
+                m_node = m_node->parent;
+            }
+        }
+        return *this;
+    }
+
+    BstIterator operator--(int)
+    {
+        BstIterator previous = *this;
+        --(*this);
+        return previous;
+    }
+
+    bool operator==(const BstIterator& other) const
+    {
+        return m_node == other.m_node;
+    }
+
+    bool operator!=(const BstIterator& other) const
+    {
+        return m_node != other.m_node;
+    }
+
+    /// @brief Gets the node the iterator is at (nullptr at the end).
+    Node<T>* GetNode() const
+    {
+        return m_node;
+    }
+
+    /// @brief Gets the address of the tree's root pointer.
+    Node<T>* const* GetRootLink() const
+    {
+        return m_rootLink;
+    }
+
+private:
+    Node<T>* m_node;              //!< Current node; nullptr at the end.
+    Node<T>* const* m_rootLink;   //!< The tree's root pointer, for stepping back from the end.
+};
+
+/**
+ * @class BstRange
+ * @brief A pair of Bst iterators usable in a range-based for loop.
+ */
+template <class Iterator>
+class BstRange
+{
+public:
+    /// @brief Creates an empty range.
+    BstRange() : m_begin(), m_end() {}
+
+    BstRange(Iterator first, Iterator last) : m_begin(first), m_end(last) {}
+
+    Iterator begin() const
+    {
+        return m_begin;
+    }
+
+    Iterator end() const
+    {
+        return m_end;
+    }
+
+    /// @brief Checks whether the range holds no items.
+    bool isEmpty() const
+    {
+        return m_begin == m_end;
+    }
+
+private:
+    Iterator m_begin; //!< First item in the range.
+    Iterator m_end;   //!< One past the last item.
 };
 
 /**
@@ -36,18 +253,39 @@ struct Node
  * deletion, searching, and different traversal orders. It adheres to the
  * Rule of Three by providing a destructor, copy constructor, and
  * copy assignment operator.
- * * @tparam T The type of data elements stored in the BST. This type must support
- * comparison operators (<, >, ==).
+ * * @tparam T The type of data elements stored in the BST. Items are ordered by
+ * BstKey<T>::Get(item) using operator< only; two items are equal when neither is less.
+ * @tparam Alloc Standard-library style allocator the nodes are allocated from
+ * (e.g. an ArenaAllocator to keep a whole tree in a few blocks).
+ * @tparam Balance BstBalance::Avl rebalances after every insert and delete.
+ * Search, Insert and DestroyTree are loops in both modes, so a degenerate
+ * unbalanced tree cannot overflow the stack there. Nodes keep a parent link,
+ * so begin()/end(), LowerBound/UpperBound and GetRange give bidirectional
+ * iterators that can stop early or cover just a key range.
  */
-template <class T>
+template <class T, class Alloc = std::allocator<T>, BstBalance Balance = BstBalance::None>
 class Bst
 {
 public:
+    /// @brief The type items are ordered and looked up by.
+    typedef typename BstKey<T>::KeyType Key;
+
+    typedef BstIterator<T, false> iterator;
+    typedef BstIterator<T, true> const_iterator;
+    typedef BstRange<iterator> Range;
+    typedef BstRange<const_iterator> ConstRange;
+
     /**
      * @brief Default constructor.
      * Initializes an empty tree by setting the root pointer to nullptr.
      */
-    Bst(): m_root(nullptr) {};
+    Bst(): m_root(nullptr), m_allocator() {};
+
+    /**
+     * @brief Constructor for an empty tree whose nodes come from the given allocator.
+     * @param allocator The allocator (copies and new nodes keep using it).
+     */
+    explicit Bst(const Alloc& allocator): m_root(nullptr), m_allocator(allocator) {};
 
     /**
      * @brief Destructor.
@@ -56,7 +294,7 @@ public:
     ~Bst();
 
     /**
-     * @brief Copy constructor for deep copying the BST.
+     * @brief Copy constructor for deep copying the BST. The copy uses the same allocator.
      * @param otherTree The BST object to be copied.
      */
     Bst(const Bst& otherTree); // copy constructor
@@ -64,11 +302,26 @@ public:
     /**
      * @brief Copy assignment operator for deep copying the BST.
      * Handles self-assignment and performs a deep copy of the structure.
+     * The tree keeps its own allocator.
      * @param other The BST object on the right-hand side of the assignment.
      * @return A constant reference to the current object (*this).
      */
     const Bst& operator=(const Bst&); // copy assignment operator
 
+    /**
+     * @brief Move constructor. Takes over the nodes; the source is left empty.
+     * @param otherTree The BST to move from.
+     */
+    Bst(Bst&& otherTree) noexcept;
+
+    /**
+     * @brief Move assignment operator. Takes over the nodes if both trees share an allocator,
+     * otherwise moves the items into new nodes of this tree's allocator. The source is left empty.
+     * @param other The BST to move from.
+     * @return A reference to the current object (*this).
+     */
+    Bst& operator=(Bst&& other);
+
     /**
      * @brief Checks if the tree is empty.
      * @return true if the root is nullptr, false otherwise.
@@ -102,12 +355,93 @@ public:
      */
     void PostOrder(visit_t<T> visit_func, void* userData);
 
+    /**
+     * @brief Performs an InOrder traversal, calling visit(item) on each item.
+     * The callable is inlined (a capturing lambda works). If it returns bool,
+     * returning false stops the traversal. Walks the parent links, so a
+     * degenerate tree does not recurse.
+     * @param visit The callable, taking T& (const T& on a const tree).
+     * @return false if the visitor stopped the traversal early, true otherwise.
+     */
+    template <class Visitor>
+    bool InOrder(Visitor&& visit);
+    template <class Visitor>
+    bool InOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Performs a PreOrder traversal, calling visit(item) on each item (see the callable InOrder).
+     * @param visit The callable, taking T& (const T& on a const tree).
+     * @return false if the visitor stopped the traversal early, true otherwise.
+     */
+    template <class Visitor>
+    bool PreOrder(Visitor&& visit);
+    template <class Visitor>
+    bool PreOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Performs a PostOrder traversal, calling visit(item) on each item (see the callable InOrder).
+     * @param visit The callable, taking T& (const T& on a const tree).
+     * @return false if the visitor stopped the traversal early, true otherwise.
+     */
+    template <class Visitor>
+    bool PostOrder(Visitor&& visit);
+    template <class Visitor>
+    bool PostOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Gets an iterator to the smallest item (iteration is in key order).
+     * Items must not be modified in a way that changes their key.
+     * @return The iterator; equal to end() for an empty tree.
+     */
+    iterator begin();
+    const_iterator begin() const;
+
+    /**
+     * @brief Gets the past-the-end iterator.
+     * @return The iterator.
+     */
+    iterator end();
+    const_iterator end() const;
+
+    /**
+     * @brief Finds the first item whose key is not less than key.
+     * @param key The key to look for.
+     * @return The iterator, or end() if every key is less.
+     */
+    iterator LowerBound(const Key& key);
+    const_iterator LowerBound(const Key& key) const;
+
+    /**
+     * @brief Finds the first item whose key is greater than key.
+     * @param key The key to look for.
+     * @return The iterator, or end() if no key is greater.
+     */
+    iterator UpperBound(const Key& key);
+    const_iterator UpperBound(const Key& key) const;
+
+    /**
+     * @brief Gets the items with keys from first to last inclusive, e.g. Range(2010, 2014).
+     * Finding the ends costs two descents; iterating only touches the nodes in range
+     * (plus their ancestors on the way between them).
+     * @param first The smallest key wanted.
+     * @param last The largest key wanted.
+     * @return The range (empty if last < first).
+     */
+    Range GetRange(const Key& first, const Key& last);
+    ConstRange GetRange(const Key& first, const Key& last) const;
+
     /**
      * @brief Inserts a new element into the BST while maintaining the search tree property.
      * @param data The element to be inserted.
      */
     void Insert(const T & data);
 
+    /**
+     * @brief Inserts a new element, moving it into the new node (nothing is moved if it is already present).
+     * @param data The element to be inserted.
+     */
+    void Insert(T&& data);
+
     /**
      * @brief Searches for a specific element in the tree.
      * @param data The element to search for (used for comparison).
@@ -122,89 +456,227 @@ public:
      */
     const T* Search(const T& data) const;
 
+    /**
+     * @brief Searches for the element with the given key.
+     * @param key The key to look for.
+     * @return A pointer to the data in the tree, or nullptr if not found.
+     */
+    T* Find(const Key& key);
+
+    /**
+     * @brief Searches for the element with the given key (const-safe version).
+     * @param key The key to look for.
+     * @return A const pointer to the data in the tree, or nullptr if not found.
+     */
+    const T* Find(const Key& key) const;
+
+    /**
+     * @brief Finds the element with the given key, constructing it in place if it is missing.
+     * A single descent does both; nothing is built or copied when the key is present.
+     * @param key The key to look for.
+     * @param args Constructor arguments for the new element; it must have the given key.
+     * @return A pointer to the found or new data (stable until that element is deleted).
+     */
+    template <class... Args>
+    T* FindOrInsert(const Key& key, Args&&... args);
+
 
     /**
      * @brief Deletes a node containing the specified target data.
-     * Handles nodes with zero, one, or two children.
+     * Handles nodes with zero, one, or two children; a node with two children is
+     * replaced by relinking its in-order successor node, so no item is copied.
      * @param deleteTarget The value of the node to be deleted.
      */
     void DeleteNode(const T& deleteTarget);
 
+    /**
+     * @brief Replaces the contents with the items of a sorted range, building a height-balanced tree in O(n).
+     * Each node takes the middle item of its part of the range, so no comparisons or rotations
+     * are needed beyond one check that the keys are strictly increasing.
+     * @param first Start of the range; the items must be sorted by key with no repeated keys.
+     * @param last End of the range.
+     * @return false (leaving the tree empty) if the range is not strictly increasing.
+     */
+    template <class ForwardIt>
+    bool BuildFromSorted(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief Relinks the existing nodes into a height-balanced tree in O(n).
+     * Nothing is allocated for the nodes or copied, so pointers to items stay valid.
+     * Use it after a large batch of inserts, e.g. once loading has finished.
+     */
+    void Rebalance();
+
+    /**
+     * @brief Gets the height of the tree (number of nodes on the longest root-to-leaf path).
+     * O(1) for AVL trees, a full walk otherwise.
+     * @return The height; 0 for an empty tree.
+     */
+    int GetHeight() const;
+
 private:
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>> NodeAlloc;
+    typedef std::allocator_traits<NodeAlloc> NodeTraits;
+
     /// @brief Pointer to the root node of the BST.
     Node<T> *m_root;
 
+    /// @brief Allocator for the nodes.
+    NodeAlloc m_allocator;
+
+    /// @brief Allocates a leaf node whose data is constructed from args.
+    template <class... Args>
+    Node<T>* createNode(Args&&... args);
+
+    /// @brief Destroys and frees a single node.
+    void freeNode(Node<T>* p);
+
     /// @brief Recursive helper function to perform a deep copy of the tree structure.
     void copyTree(Node<T>* &copiedTreeRoot, Node<T>* otherTreeRoot);
 
-    /// @brief Recursive helper function to deallocate all nodes in the tree (post-order traversal).
+    /// @brief Recursive helper that rebuilds a tree in this tree's allocator, moving every item out of the source.
+    void moveTree(Node<T>* &movedTreeRoot, Node<T>* otherTreeRoot);
+
+    /// @brief Points the parent links of p's children back at p.
+    static void linkChildren(Node<T>* p);
+
+    /// @brief Deallocates all nodes of a subtree without recursion, rotating left children up as it goes.
     void destroy(Node<T>* &p);
 
     // ---
     // PRIVATE TRAVERSAL HELPERS
     // ---
-    void inorder(Node<T> *p, visit_t<T> visit_func, void* userData);
-    void preorder(Node<T> *p, visit_t<T> visit_func, void* userData);
-    void postorder(Node<T> *p, visit_t<T> visit_func, void* userData);
+    /// @brief Calls visit(item); returns false only if the callable returns false.
+    template <class Visitor, class Item>
+    static bool visitItem(Visitor& visit, Item& item);
+
+    template <class Item, class Visitor>
+    static bool preorder(Node<T> *p, Visitor& visit);
+    template <class Item, class Visitor>
+    static bool postorder(Node<T> *p, Visitor& visit);
+
+    /// @brief Loop-based lookup of the node holding key.
+    Node<T>* findNode(const Key& key) const;
+
+    /// @brief Loop-based lookup of the first node whose key is not less (upper: greater) than key.
+    Node<T>* boundNode(const Key& key, bool upper) const;
 
-    /// @brief Recursive helper function for inserting a node.
-    void insert(Node<T>* &p, const T& data);
+    /// @brief Links nodes[lo, hi) (in key order) into a balanced subtree under parent; returns its root.
+    static Node<T>* linkBalanced(const std::vector<Node<T>*>& nodes, size_t lo, size_t hi, Node<T>* parent);
+
+    /// @brief Gets the leftmost node of the tree, or nullptr if it is empty.
+    Node<T>* firstNode() const;
+
+    /// @brief Loop-based find-or-create shared by Insert and FindOrInsert; rebalances AVL trees.
+    template <class... Args>
+    Node<T>* findOrCreateNode(const Key& key, Args&&... args);
 
     // ---
-    // PRIVATE SEARCH HELPERS
+    // PRIVATE AVL HELPERS
     // ---
-    T* search(Node<T> *p, const T& data);
-    const T* search(Node<T> *p, const T& data) const;
+    static int heightOf(const Node<T>* p);
+    static void updateHeight(Node<T>* p);
+    static void rotateLeft(Node<T>* &p);
+    static void rotateRight(Node<T>* &p);
+
+    /// @brief Restores the AVL property at p after one of its subtrees changed height by one.
+    static void rebalance(Node<T>* &p);
 
-    /// @brief Recursive helper function for deleting a node.
+    /// @brief Recursive helper function for deleting a node (recursion depth is the tree height).
     void deleteNode(Node<T>* &p, const T& deleteTarget);
 
     /**
-     * @brief Finds the minimum value in a given subtree.
-     * Used by deleteNode to find the inorder successor (smallest element in the right subtree).
-     * @param p The root of the subtree to search.
-     * @return The minimum value found.
-     * @throw std::runtime_error if called on a nullptr.
+     * @brief Unlinks the minimum node of a non-empty subtree, rebalancing AVL trees on the way back up.
+     * Used by deleteNode to take out the inorder successor (smallest element in the right subtree).
+     * @param p The root of the subtree; updated to the subtree's new root.
+     * @return The unlinked node (its children are left dangling).
      */
-    T getMin(Node<T>* p) const;
+    Node<T>* detachMin(Node<T>* &p);
 };
 
-template <class T>
-bool Bst<T>::isEmpty() const
+template <class T, class Alloc, BstBalance Balance>
+bool Bst<T, Alloc, Balance>::isEmpty() const
 {
     return (m_root == nullptr);
 }
 
-template <class T>
-void Bst<T>::DestroyTree()
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::DestroyTree()
 {
     destroy(m_root);
 }
 
-template <class T>
-Bst<T>::~Bst()
+template <class T, class Alloc, BstBalance Balance>
+Bst<T, Alloc, Balance>::~Bst()
 {
     DestroyTree();
 }
 
-// Private Recursive Helper to destroy the tree
-template <class T>
-void Bst<T>::destroy(Node<T>* &p)
+template <class T, class Alloc, BstBalance Balance>
+template <class... Args>
+Node<T>* Bst<T, Alloc, Balance>::createNode(Args&&... args)
+{
+    Node<T>* p = NodeTraits::allocate(m_allocator, 1);
+    try
+    {
+        NodeTraits::construct(m_allocator, p, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        NodeTraits::deallocate(m_allocator, p, 1);
+        throw;
+    }
+    return p;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::freeNode(Node<T>* p)
+{
+    NodeTraits::destroy(m_allocator, p);
+    NodeTraits::deallocate(m_allocator, p, 1);
+}
+
+// Private Helper to destroy the tree
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::destroy(Node<T>* &p)
+{
+    while (p != nullptr)
+    {
+        if (p->left != nullptr)
+        {
+            // Rotate right so the left subtree moves up; nodes are freed once they have no left child
+            Node<T>* left = p->left;
+            p->left = left->right;
+            left->right = p;
+            p = left;
+        }
+        else
+        {
+            Node<T>* right = p->right;
+            freeNode(p);
+            p = right;
+        }
+    }
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::linkChildren(Node<T>* p)
 {
-    if (p != nullptr)
+    if (p->left != nullptr)
+    {
+        p->left->parent = p;
+    }
+    if (p->right != nullptr)
     {
-        destroy(p->left);
-        destroy(p->right);
-        delete p;
-        p = nullptr;
+        p->right->parent = p;
     }
 }
 
 // --- Copy Operations ---
 
 // Private Recursive Helper to perform deep copy
-template <class T>
-void Bst<T>::copyTree(Node<T>* &copiedTreeRoot, Node<T>* otherTreeRoot)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::copyTree(Node<T>* &copiedTreeRoot, Node<T>* otherTreeRoot)
 {
     if (otherTreeRoot == nullptr)
     {
@@ -212,24 +684,45 @@ void Bst<T>::copyTree(Node<T>* &copiedTreeRoot, Node<T>* otherTreeRoot)
     }
     else
     {
-        copiedTreeRoot = new Node<T>;
-        copiedTreeRoot->info = otherTreeRoot->info;
+        copiedTreeRoot = createNode(otherTreeRoot->info);
+        copiedTreeRoot->height = otherTreeRoot->height;
 
         copyTree(copiedTreeRoot->left, otherTreeRoot->left);
         copyTree(copiedTreeRoot->right, otherTreeRoot->right);
+        linkChildren(copiedTreeRoot);
+    }
+}
+
+// Private Recursive Helper to move the items into new nodes
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::moveTree(Node<T>* &movedTreeRoot, Node<T>* otherTreeRoot)
+{
+    if (otherTreeRoot == nullptr)
+    {
+        movedTreeRoot = nullptr;
+    }
+    else
+    {
+        movedTreeRoot = createNode(std::move(otherTreeRoot->info));
+        movedTreeRoot->height = otherTreeRoot->height;
+
+        moveTree(movedTreeRoot->left, otherTreeRoot->left);
+        moveTree(movedTreeRoot->right, otherTreeRoot->right);
+        linkChildren(movedTreeRoot);
     }
 }
 
 // Copy Constructor
-template <class T>
-Bst<T>::Bst(const Bst& otherTree):m_root(nullptr)
+template <class T, class Alloc, BstBalance Balance>
+Bst<T, Alloc, Balance>::Bst(const Bst& otherTree)
+    : m_root(nullptr), m_allocator(NodeTraits::select_on_container_copy_construction(otherTree.m_allocator))
 {
     copyTree(m_root, otherTree.m_root);
 }
 
 // Copy Assignment Operator
-template <class T>
-const Bst<T>& Bst<T>::operator=(const Bst<T>& other)
+template <class T, class Alloc, BstBalance Balance>
+const Bst<T, Alloc, Balance>& Bst<T, Alloc, Balance>::operator=(const Bst<T, Alloc, Balance>& other)
 {
     if (this != &other)
     {
@@ -239,171 +732,590 @@ const Bst<T>& Bst<T>::operator=(const Bst<T>& other)
     return *this;
 }
 
+// Move Constructor
+template <class T, class Alloc, BstBalance Balance>
+Bst<T, Alloc, Balance>::Bst(Bst&& otherTree) noexcept
+    : m_root(otherTree.m_root), m_allocator(std::move(otherTree.m_allocator))
+{
+    otherTree.m_root = nullptr;
+}
+
+// Move Assignment Operator
+template <class T, class Alloc, BstBalance Balance>
+Bst<T, Alloc, Balance>& Bst<T, Alloc, Balance>::operator=(Bst<T, Alloc, Balance>&& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    DestroyTree();
+    if (NodeTraits::propagate_on_container_move_assignment::value || m_allocator == other.m_allocator)
+    {
+        if (NodeTraits::propagate_on_container_move_assignment::value)
+        {
+            m_allocator = std::move(other.m_allocator);
+        }
+        m_root = other.m_root;
+        other.m_root = nullptr;
+    }
+    else
+    {
+        // The nodes belong to the other allocator: move the items into nodes of ours
+        moveTree(m_root, other.m_root);
+        other.DestroyTree();
+    }
+    return *this;
+}
+
 // --- Insertion ---
-template <class T>
-void Bst<T>::Insert(const T& data)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::Insert(const T& data)
 {
-    insert(m_root, data);
+    findOrCreateNode(BstKey<T>::Get(data), data);
 }
 
-template <class T>
-void Bst<T>::insert(Node<T>* &p, const T& data)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::Insert(T&& data)
 {
-    if (p == nullptr)
+    // The key is only read during the descent, before data is moved into the new node
+    findOrCreateNode(BstKey<T>::Get(data), std::move(data));
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class... Args>
+T* Bst<T, Alloc, Balance>::FindOrInsert(const Key& key, Args&&... args)
+{
+    return &(findOrCreateNode(key, std::forward<Args>(args)...)->info);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class... Args>
+Node<T>* Bst<T, Alloc, Balance>::findOrCreateNode(const Key& key, Args&&... args)
+{
+    // Walk down to the empty link, remembering the links taken so an AVL tree can be fixed on the way back
+    Node<T>** path[BST_MAX_AVL_HEIGHT];
+    int depth = 0;
+    Node<T>** link = &m_root;
+    Node<T>* parent = nullptr;
+    while (*link != nullptr)
     {
-        p = new Node<T>;
-        p->info = data;
-        p->left = nullptr;
-        p->right = nullptr;
+        Node<T>* p = *link;
+        parent = p;
+        if (Balance == BstBalance::Avl)
+        {
+            path[depth++] = link;
+        }
+
+        if (key < BstKey<T>::Get(p->info))
+        {
+            link = &p->left;
+        }
+        else if (BstKey<T>::Get(p->info) < key)
+        {
+            link = &p->right;
+        }
+        else
+        {
+            return p; // Already present
+        }
     }
-    else if (data < p->info)
+    Node<T>* created = createNode(std::forward<Args>(args)...);
+    created->parent = parent;
+    *link = created;
+
+    if (Balance == BstBalance::Avl)
     {
-        insert(p->left, data);
+        // Stop as soon as a subtree's height is unchanged: nothing above it can be out of balance.
+        // Rotations relink nodes but never move them, so created stays valid.
+        while (depth > 0)
+        {
+            Node<T>*& p = *path[--depth];
+            int oldHeight = p->height;
+            rebalance(p);
+            if (p->height == oldHeight)
+            {
+                break;
+            }
+        }
     }
-    else if (data > p->info)
+    return created;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+Node<T>* Bst<T, Alloc, Balance>::findNode(const Key& key) const
+{
+    Node<T>* p = m_root;
+    while (p != nullptr)
     {
-        insert(p->right, data);
+        if (key < BstKey<T>::Get(p->info))
+        {
+            p = p->left;
+        }
+        else if (BstKey<T>::Get(p->info) < key)
+        {
+            p = p->right;
+        }
+        else
+        {
+            return p;
+        }
     }
+    return nullptr;
 }
 
-template <class T>
-T* Bst<T>::Search(const T& data)
+template <class T, class Alloc, BstBalance Balance>
+T* Bst<T, Alloc, Balance>::Search(const T& data)
 {
-    return search(m_root, data);
+    return Find(BstKey<T>::Get(data));
 }
 
-template <class T>
-T* Bst<T>::search(Node<T> *p, const T& data)
+template <class T, class Alloc, BstBalance Balance>
+const T* Bst<T, Alloc, Balance>::Search(const T& data) const
 {
-    if (p == nullptr)
+    return Find(BstKey<T>::Get(data));
+}
+
+template <class T, class Alloc, BstBalance Balance>
+T* Bst<T, Alloc, Balance>::Find(const Key& key)
+{
+    Node<T>* p = findNode(key);
+    return (p != nullptr) ? &(p->info) : nullptr; // Return ADDRESS of data
+}
+
+template <class T, class Alloc, BstBalance Balance>
+const T* Bst<T, Alloc, Balance>::Find(const Key& key) const
+{
+    const Node<T>* p = findNode(key);
+    return (p != nullptr) ? &(p->info) : nullptr; // Return CONST ADDRESS of data
+}
+
+// --- Iteration ---
+template <class T, class Alloc, BstBalance Balance>
+Node<T>* Bst<T, Alloc, Balance>::firstNode() const
+{
+    Node<T>* p = m_root;
+    while (p != nullptr && p->left != nullptr)
+    {
+        p = p->left;
+    }
+    return p;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+Node<T>* Bst<T, Alloc, Balance>::boundNode(const Key& key, bool upper) const
+{
+    // The last node we turned left at is the smallest one past the bound seen so far
+    Node<T>* bound = nullptr;
+    Node<T>* p = m_root;
+    while (p != nullptr)
+    {
+        const Key& nodeKey = BstKey<T>::Get(p->info);
+        if (upper ? (key < nodeKey) : !(nodeKey < key))
+        {
+            bound = p;
+            p = p->left;
+        }
+        else
+        {
+            p = p->right;
+        }
+    }
+    return bound;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::iterator Bst<T, Alloc, Balance>::begin()
+{
+    return iterator(firstNode(), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::const_iterator Bst<T, Alloc, Balance>::begin() const
+{
+    return const_iterator(firstNode(), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::iterator Bst<T, Alloc, Balance>::end()
+{
+    return iterator(nullptr, &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::const_iterator Bst<T, Alloc, Balance>::end() const
+{
+    return const_iterator(nullptr, &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::iterator Bst<T, Alloc, Balance>::LowerBound(const Key& key)
+{
+    return iterator(boundNode(key, false), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::const_iterator Bst<T, Alloc, Balance>::LowerBound(const Key& key) const
+{
+    return const_iterator(boundNode(key, false), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::iterator Bst<T, Alloc, Balance>::UpperBound(const Key& key)
+{
+    return iterator(boundNode(key, true), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::const_iterator Bst<T, Alloc, Balance>::UpperBound(const Key& key) const
+{
+    return const_iterator(boundNode(key, true), &m_root);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::Range Bst<T, Alloc, Balance>::GetRange(const Key& first, const Key& last)
+{
+    if (last < first)
+    {
+        return Range(end(), end());
+    }
+    return Range(LowerBound(first), UpperBound(last));
+}
+
+template <class T, class Alloc, BstBalance Balance>
+typename Bst<T, Alloc, Balance>::ConstRange Bst<T, Alloc, Balance>::GetRange(const Key& first, const Key& last) const
+{
+    if (last < first)
+    {
+        return ConstRange(end(), end());
+    }
+    return ConstRange(LowerBound(first), UpperBound(last));
+}
+
+// --- Bulk Construction ---
+template <class T, class Alloc, BstBalance Balance>
+Node<T>* Bst<T, Alloc, Balance>::linkBalanced(const std::vector<Node<T>*>& nodes, size_t lo, size_t hi, Node<T>* parent)
+{
+    if (lo >= hi)
     {
         return nullptr;
     }
-    else if (data == p->info)
+    size_t mid = lo + (hi - lo) / 2;
+    Node<T>* p = nodes[mid];
+    p->parent = parent;
+    p->left = linkBalanced(nodes, lo, mid, p);
+    p->right = linkBalanced(nodes, mid + 1, hi, p);
+    updateHeight(p);
+    return p;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class ForwardIt>
+bool Bst<T, Alloc, Balance>::BuildFromSorted(ForwardIt first, ForwardIt last)
+{
+    DestroyTree();
+
+    std::vector<Node<T>*> nodes;
+    nodes.reserve(static_cast<size_t>(std::distance(first, last)));
+    try
     {
-        return &(p->info); // Return ADDRESS of data
+        for (; first != last; ++first)
+        {
+            if (!nodes.empty() && !(BstKey<T>::Get(nodes.back()->info) < BstKey<T>::Get(*first)))
+            {
+                break; // Out of order or repeated
+            }
+            nodes.push_back(createNode(*first));
+        }
     }
-    else if (data < p->info)
+    catch (...)
     {
-        return search(p->left, data);
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            freeNode(nodes[i]);
+        }
+        throw;
     }
-    else
+
+    if (first != last)
     {
-        return search(p->right, data);
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            freeNode(nodes[i]);
+        }
+        return false;
     }
+    m_root = linkBalanced(nodes, 0, nodes.size(), nullptr);
+    return true;
 }
 
-template <class T>
-const T* Bst<T>::Search(const T& data) const
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::Rebalance()
 {
-    return search(m_root, data);
+    std::vector<Node<T>*> nodes;
+    for (iterator it = begin(); it != end(); ++it)
+    {
+        nodes.push_back(it.GetNode());
+    }
+    m_root = linkBalanced(nodes, 0, nodes.size(), nullptr);
 }
 
-template <class T>
-const T* Bst<T>::search(Node<T> *p, const T& data) const
+// --- Balancing ---
+template <class T, class Alloc, BstBalance Balance>
+int Bst<T, Alloc, Balance>::heightOf(const Node<T>* p)
 {
-    if (p == nullptr)
+    return (p == nullptr) ? 0 : p->height;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::updateHeight(Node<T>* p)
+{
+    int leftHeight = heightOf(p->left);
+    int rightHeight = heightOf(p->right);
+    p->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::rotateLeft(Node<T>* &p)
+{
+    Node<T>* right = p->right;
+    p->right = right->left;
+    right->left = p;
+    right->parent = p->parent;
+    linkChildren(p);
+    linkChildren(right);
+    updateHeight(p);
+    updateHeight(right);
+    p = right;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::rotateRight(Node<T>* &p)
+{
+    Node<T>* left = p->left;
+    p->left = left->right;
+    left->right = p;
+    left->parent = p->parent;
+    linkChildren(p);
+    linkChildren(left);
+    updateHeight(p);
+    updateHeight(left);
+    p = left;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::rebalance(Node<T>* &p)
+{
+    updateHeight(p);
+    int balance = heightOf(p->left) - heightOf(p->right);
+    if (balance > 1)
     {
-        return nullptr;
+        if (heightOf(p->left->left) < heightOf(p->left->right))
+        {
+            rotateLeft(p->left); // Left-right case
+        }
+        rotateRight(p);
+    }
+    else if (balance < -1)
+    {
+        if (heightOf(p->right->right) < heightOf(p->right->left))
+        {
+            rotateRight(p->right); // Right-left case
+        }
+        rotateLeft(p);
+    }
+}
+
+template <class T, class Alloc, BstBalance Balance>
+int Bst<T, Alloc, Balance>::GetHeight() const
+{
+    if (Balance == BstBalance::Avl)
+    {
+        return heightOf(m_root);
     }
-    else if (data == p->info)
+
+    // Count levels breadth first; a degenerate tree would be too deep to recurse
+    std::vector<const Node<T>*> level;
+    std::vector<const Node<T>*> next;
+    if (m_root != nullptr)
     {
-        return &(p->info); // Return CONST ADDRESS of data
+        level.push_back(m_root);
     }
-    else if (data < p->info)
+    int height = 0;
+    while (!level.empty())
     {
-        return search(p->left, data);
+        height++;
+        next.clear();
+        for (size_t i = 0; i < level.size(); ++i)
+        {
+            if (level[i]->left != nullptr)
+            {
+                next.push_back(level[i]->left);
+            }
+            if (level[i]->right != nullptr)
+            {
+                next.push_back(level[i]->right);
+            }
+        }
+        level.swap(next);
+    }
+    return height;
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor, class Item>
+bool Bst<T, Alloc, Balance>::visitItem(Visitor& visit, Item& item)
+{
+    if constexpr (std::is_void<decltype(visit(item))>::value)
+    {
+        visit(item);
+        return true;
     }
     else
     {
-        return search(p->right, data);
+        return static_cast<bool>(visit(item));
     }
 }
 
-template <class T>
-void Bst<T>::InOrder(visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::InOrder(visit_t<T> visit_func, void* userData)
 {
-    inorder(m_root, visit_func, userData);
+    InOrder([visit_func, userData](T& item) { visit_func(item, userData); });
 }
 
-template <class T>
-void Bst<T>::inorder(Node<T> *p, visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::InOrder(Visitor&& visit)
 {
-    if (p != nullptr)
+    for (iterator it = begin(); it != end(); ++it)
     {
-        inorder(p->left, visit_func, userData);
-        visit_func(p->info, userData); // Call the "visit" function
-        inorder(p->right, visit_func, userData);
+        if (!visitItem(visit, *it))
+        {
+            return false;
+        }
     }
+    return true;
 }
 
-template <class T>
-void Bst<T>::PreOrder(visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::InOrder(Visitor&& visit) const
 {
-    preorder(m_root, visit_func, userData);
+    for (const_iterator it = begin(); it != end(); ++it)
+    {
+        if (!visitItem(visit, *it))
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-template <class T>
-void Bst<T>::preorder(Node<T> *p, visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::PreOrder(visit_t<T> visit_func, void* userData)
+{
+    PreOrder([visit_func, userData](T& item) { visit_func(item, userData); });
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::PreOrder(Visitor&& visit)
+{
+    return preorder<T>(m_root, visit);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::PreOrder(Visitor&& visit) const
+{
+    return preorder<const T>(m_root, visit);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Item, class Visitor>
+bool Bst<T, Alloc, Balance>::preorder(Node<T> *p, Visitor& visit)
 {
-    if (p != nullptr)
+    if (p == nullptr)
     {
-        visit_func(p->info, userData); // Call the "visit" function
-        preorder(p->left, visit_func, userData);
-        preorder(p->right, visit_func, userData);
+        return true;
     }
+    Item& item = p->info; // Item is const T when traversing a const tree
+    return visitItem(visit, item) && preorder<Item>(p->left, visit) && preorder<Item>(p->right, visit);
 }
 
-template <class T>
-void Bst<T>::PostOrder(visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::PostOrder(visit_t<T> visit_func, void* userData)
 {
-    postorder(m_root, visit_func, userData);
+    PostOrder([visit_func, userData](T& item) { visit_func(item, userData); });
 }
 
-template <class T>
-void Bst<T>::postorder(Node<T> *p, visit_t<T> visit_func, void* userData)
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::PostOrder(Visitor&& visit)
 {
-    if (p != nullptr)
+    return postorder<T>(m_root, visit);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Visitor>
+bool Bst<T, Alloc, Balance>::PostOrder(Visitor&& visit) const
+{
+    return postorder<const T>(m_root, visit);
+}
+
+template <class T, class Alloc, BstBalance Balance>
+template <class Item, class Visitor>
+bool Bst<T, Alloc, Balance>::postorder(Node<T> *p, Visitor& visit)
+{
+    if (p == nullptr)
     {
-        postorder(p->left, visit_func, userData);
-        postorder(p->right, visit_func, userData);
-        visit_func(p->info, userData); // Call the "visit" function
+        return true;
     }
+    Item& item = p->info;
+    return postorder<Item>(p->left, visit) && postorder<Item>(p->right, visit) && visitItem(visit, item);
 }
 
 // --- Deletion ---
-template <class T>
-T Bst<T>::getMin(Node<T>* p) const
+template <class T, class Alloc, BstBalance Balance>
+Node<T>* Bst<T, Alloc, Balance>::detachMin(Node<T>* &p)
 {
-    if (p == nullptr)
+    if (p->left == nullptr)
     {
-        throw runtime_error("Attempted to get minimum of a null node.");
+        Node<T>* minNode = p;
+        p = p->right;
+        if (p != nullptr)
+        {
+            p->parent = minNode->parent;
+        }
+        return minNode;
     }
-    while (p->left != nullptr)
+
+    Node<T>* minNode = detachMin(p->left);
+    if (Balance == BstBalance::Avl)
     {
-        p = p->left;
+        rebalance(p);
     }
-    return p->info;
+    return minNode;
 }
 
-template <class T>
-void Bst<T>::DeleteNode(const T& deleteTarget)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::DeleteNode(const T& deleteTarget)
 {
     deleteNode(m_root, deleteTarget);
 }
 
-template <class T>
-void Bst<T>::deleteNode(Node<T>* &p, const T& deleteTarget)
+template <class T, class Alloc, BstBalance Balance>
+void Bst<T, Alloc, Balance>::deleteNode(Node<T>* &p, const T& deleteTarget)
 {
     if (p == nullptr)
     {
         return;
     }
-    else if (deleteTarget < p->info)
+    else if (BstKey<T>::Get(deleteTarget) < BstKey<T>::Get(p->info))
     {
         deleteNode(p->left, deleteTarget);
     }
-    else if (deleteTarget > p->info)
+    else if (BstKey<T>::Get(p->info) < BstKey<T>::Get(deleteTarget))
     {
         deleteNode(p->right, deleteTarget);
     }
@@ -414,18 +1326,29 @@ void Bst<T>::deleteNode(Node<T>* &p, const T& deleteTarget)
         if (p->left == nullptr)
         {
             p = p->right;
-            delete temp;
         }
         else if (p->right == nullptr)
         {
             p = p->left;
-            delete temp;
         }
-        else // Two children
+        else // Two children: the successor node takes this node's place
+        {
+            Node<T>* successor = detachMin(p->right);
+            successor->left = p->left;
+            successor->right = p->right;
+            linkChildren(successor);
+            p = successor;
+        }
+        if (p != nullptr)
         {
-            p->info = getMin(p->right);
-            deleteNode(p->right, p->info);
+            p->parent = temp->parent;
         }
+        freeNode(temp);
+    }
+
+    if (Balance == BstBalance::Avl && p != nullptr)
+    {
+        rebalance(p);
     }
 }
 
@@ -0,0 +1,286 @@
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+#include "Arena.h"
+#include "Bst.h"
+
+using namespace std;
+
+typedef Bst<int, std::allocator<int>, BstBalance::Avl> AvlTree;
+
+// Item looked up by its id alone; counts how often it is constructed
+struct Station
+{
+    static int constructed;
+    static int moved;
+    Station(int i, const string& n) : id(i), name(n) { constructed++; }
+    Station(const Station& other) : id(other.id), name(other.name) { constructed++; }
+    Station(Station&& other) : id(other.id), name(std::move(other.name)) { moved++; }
+    Station& operator=(const Station& other) { id = other.id; name = other.name; constructed++; return *this; }
+    int id;
+    string name;
+};
+int Station::constructed = 0;
+int Station::moved = 0;
+
+template <>
+struct BstKey<Station>
+{
+    typedef int KeyType;
+    static int Get(const Station& item)
+    {
+        return item.id;
+    }
+};
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static void collectVisit(int& item, void* userData)
+{
+    static_cast<vector<int>*>(userData)->push_back(item);
+}
+
+// Largest height an AVL tree of n nodes can have: 1.44 log2(n + 2)
+static int avlHeightBound(int n)
+{
+    return static_cast<int>(1.4405 * log2(n + 2.0));
+}
+
+int main()
+{
+    cout << "--- Bst Unit Tests ---" << endl;
+
+    // 1. Sorted keys (the way years arrive) keep an AVL tree logarithmic
+    cout << "\n--- Sorted Insert Height Test ---" << endl;
+    const int sortedCount = 100000;
+    AvlTree sortedTree;
+    for (int i = 0; i < sortedCount; ++i)
+    {
+        sortedTree.Insert(i);
+    }
+    cout << "AVL height after " << sortedCount << " sorted inserts: " << sortedTree.GetHeight()
+         << " (bound " << avlHeightBound(sortedCount) << ")" << endl;
+    report("Sorted Insert Height Test", sortedTree.GetHeight() <= avlHeightBound(sortedCount) &&
+           sortedTree.Search(0) != nullptr && sortedTree.Search(sortedCount - 1) != nullptr &&
+           sortedTree.Search(sortedCount) == nullptr);
+
+    // 2. The unbalanced mode degenerates into a list, but its loops do not overflow the stack
+    cout << "\n--- Unbalanced Degenerate Test ---" << endl;
+    const int listCount = 20000;
+    Bst<int> listTree;
+    for (int i = 0; i < listCount; ++i)
+    {
+        listTree.Insert(i);
+    }
+    bool listOk = listTree.GetHeight() == listCount && listTree.Search(listCount - 1) != nullptr;
+    listTree.DestroyTree();
+    report("Unbalanced Degenerate Test", listOk && listTree.isEmpty());
+
+    // 3. Random inserts and deletes agree with std::set and stay balanced
+    cout << "\n--- Random Insert / Delete Test ---" << endl;
+    AvlTree randomTree;
+    set<int> reference;
+    srand(12345);
+    for (int i = 0; i < 50000; ++i)
+    {
+        int key = rand() % 5000;
+        if (rand() % 3 == 0)
+        {
+            randomTree.DeleteNode(key);
+            reference.erase(key);
+        }
+        else
+        {
+            randomTree.Insert(key);
+            reference.insert(key);
+        }
+    }
+    vector<int> inOrder;
+    randomTree.InOrder(collectVisit, &inOrder);
+    bool sameKeys = inOrder == vector<int>(reference.begin(), reference.end());
+    report("Random Insert / Delete Test", sameKeys &&
+           randomTree.GetHeight() <= avlHeightBound(static_cast<int>(reference.size())));
+
+    // 4. Deleting down to empty
+    cout << "\n--- Delete All Test ---" << endl;
+    for (int i = 0; i < sortedCount; i += 2)
+    {
+        sortedTree.DeleteNode(i);
+    }
+    bool halfOk = sortedTree.Search(2) == nullptr && sortedTree.Search(3) != nullptr &&
+                  sortedTree.GetHeight() <= avlHeightBound(sortedCount / 2);
+    for (int i = 1; i < sortedCount; i += 2)
+    {
+        sortedTree.DeleteNode(i);
+    }
+    report("Delete All Test", halfOk && sortedTree.isEmpty() && sortedTree.GetHeight() == 0);
+
+    // 5. Copies keep the balanced shape
+    cout << "\n--- Copy Test ---" << endl;
+    AvlTree copiedTree(randomTree);
+    vector<int> copiedOrder;
+    copiedTree.InOrder(collectVisit, &copiedOrder);
+    report("Copy Test", copiedOrder == inOrder && copiedTree.GetHeight() == randomTree.GetHeight());
+
+    // 6. Key lookups: FindOrInsert builds the item once, in the node, and only when the key is new
+    cout << "\n--- Find Or Insert Test ---" << endl;
+    Bst<Station, std::allocator<Station>, BstBalance::Avl> stations;
+    Station* first = stations.FindOrInsert(7, 7, "Perth");
+    Station* again = stations.FindOrInsert(7, 7, "ignored");
+    for (int i = 0; i < 100; ++i)
+    {
+        stations.FindOrInsert(i, i, "station");
+    }
+    const auto& constStations = stations;
+    report("Find Or Insert Test", first == again && first->name == "Perth" && Station::constructed == 100 &&
+           stations.Find(7) == first && constStations.Find(42) != nullptr && stations.Find(100) == nullptr);
+
+    // 7. Rvalue inserts move the item in; deleting a node with two children relinks instead of copying
+    cout << "\n--- Move Insert / Relink Delete Test ---" << endl;
+    int constructedBefore = Station::constructed;
+    stations.Insert(Station(200, "Darwin"));
+    Station* darwin = stations.Find(200);
+    for (int i = 0; i < 100; i += 3)
+    {
+        stations.DeleteNode(Station(i, ""));
+    }
+    bool movedIn = Station::moved == 1 && darwin != nullptr && darwin->name == "Darwin";
+    report("Move Insert / Relink Delete Test", movedIn && Station::constructed == constructedBefore + 1 + 34 &&
+           stations.Find(200) == darwin && stations.Find(3) == nullptr && stations.Find(4) != nullptr);
+
+    // 8. Moving a tree takes its nodes
+    cout << "\n--- Tree Move Test ---" << endl;
+    constructedBefore = Station::constructed;
+    Bst<Station, std::allocator<Station>, BstBalance::Avl> movedStations(std::move(stations));
+    Bst<Station, std::allocator<Station>, BstBalance::Avl> assignedStations;
+    assignedStations = std::move(movedStations);
+    AvlTree movedTree(std::move(copiedTree));
+    report("Tree Move Test", Station::constructed == constructedBefore && Station::moved == 1 &&
+           stations.isEmpty() && movedStations.isEmpty() && assignedStations.Find(200) == darwin &&
+           copiedTree.isEmpty() && movedTree.GetHeight() == randomTree.GetHeight());
+
+    // 9. Move assignment between trees on different arenas moves the items into new nodes
+    cout << "\n--- Arena Tree Move Test ---" << endl;
+    Arena firstArena;
+    Arena secondArena;
+    Bst<string, ArenaAllocator<string>, BstBalance::Avl> firstTree{ArenaAllocator<string>(&firstArena)};
+    Bst<string, ArenaAllocator<string>, BstBalance::Avl> secondTree{ArenaAllocator<string>(&secondArena)};
+    for (int i = 0; i < 50; ++i)
+    {
+        firstTree.Insert("station " + to_string(i));
+    }
+    secondTree = std::move(firstTree);
+    report("Arena Tree Move Test", firstTree.isEmpty() && secondTree.Search("station 49") != nullptr &&
+           secondArena.GetBytesAllocated() == firstArena.GetBytesAllocated());
+
+    // 10. Iterators walk the items in order both ways, after rotations and deletes have relinked nodes
+    cout << "\n--- Iterator Test ---" << endl;
+    vector<int> forward(randomTree.begin(), randomTree.end());
+    vector<int> backward;
+    for (AvlTree::iterator it = randomTree.end(); it != randomTree.begin();)
+    {
+        --it;
+        backward.push_back(*it);
+    }
+    bool reversed = vector<int>(backward.rbegin(), backward.rend()) == inOrder;
+    AvlTree emptyTree;
+    bool copiesLinked = vector<int>(movedTree.begin(), movedTree.end()) == inOrder &&
+                        (--secondTree.end())->compare("station 9") == 0;
+    report("Iterator Test", forward == inOrder && reversed && copiesLinked && emptyTree.begin() == emptyTree.end());
+
+    // 11. Bounds and ranges agree with std::set
+    cout << "\n--- Bound / Range Test ---" << endl;
+    const AvlTree& constRandom = randomTree;
+    bool boundsOk = true;
+    for (int key = -1; key <= 5001; key += 7)
+    {
+        set<int>::const_iterator lower = reference.lower_bound(key);
+        set<int>::const_iterator upper = reference.upper_bound(key);
+        AvlTree::const_iterator treeLower = constRandom.LowerBound(key);
+        AvlTree::iterator treeUpper = randomTree.UpperBound(key);
+        boundsOk = boundsOk && (lower == reference.end() ? treeLower == constRandom.end() : *treeLower == *lower);
+        boundsOk = boundsOk && (upper == reference.end() ? treeUpper == randomTree.end() : *treeUpper == *upper);
+    }
+    vector<int> inRange;
+    for (int key : constRandom.GetRange(2010, 2014))
+    {
+        inRange.push_back(key);
+    }
+    vector<int> expectedRange(reference.lower_bound(2010), reference.upper_bound(2014));
+    report("Bound / Range Test", boundsOk && inRange == expectedRange &&
+           randomTree.GetRange(10, 5).isEmpty() && randomTree.GetRange(6000, 7000).isEmpty());
+
+    // 12. Callable traversals: capturing lambdas, const trees and early stop
+    cout << "\n--- Callable Traversal Test ---" << endl;
+    vector<int> lambdaOrder;
+    bool completed = constRandom.InOrder([&lambdaOrder](const int& item) { lambdaOrder.push_back(item); });
+    int visited = 0;
+    bool stopped = !randomTree.InOrder([&visited](int& item) { visited++; return item < 100; });
+    AvlTree smallTree;
+    for (int i = 1; i <= 7; ++i)
+    {
+        smallTree.Insert(i); // Balanced into 4 / 2 6 / 1 3 5 7
+    }
+    const AvlTree& constSmall = smallTree;
+    vector<int> preOrder;
+    vector<int> postOrder;
+    constSmall.PreOrder([&preOrder](const int& item) { preOrder.push_back(item); });
+    smallTree.PostOrder([&postOrder](int& item) { postOrder.push_back(item); });
+    vector<int> preExpected = {4, 2, 1, 3, 6, 5, 7};
+    vector<int> postExpected = {1, 3, 2, 5, 7, 6, 4};
+    int preVisited = 0;
+    bool preStopped = !smallTree.PreOrder([&preVisited](int& item) { preVisited++; return item != 3; });
+    report("Callable Traversal Test", completed && lambdaOrder == inOrder && stopped &&
+           visited == static_cast<int>(distance(reference.begin(), reference.lower_bound(100))) + 1 &&
+           preOrder == preExpected && postOrder == postExpected && preStopped && preVisited == 4);
+
+    // 13. Bulk construction from a sorted range gives the minimal height
+    cout << "\n--- Build From Sorted Test ---" << endl;
+    vector<int> sortedKeys;
+    for (int i = 0; i < sortedCount; ++i)
+    {
+        sortedKeys.push_back(i * 2);
+    }
+    Bst<int> builtTree;
+    bool built = builtTree.BuildFromSorted(sortedKeys.begin(), sortedKeys.end());
+    bool builtOk = built && builtTree.GetHeight() == 17 && vector<int>(builtTree.begin(), builtTree.end()) == sortedKeys &&
+                   builtTree.Search(198) != nullptr && builtTree.Search(199) == nullptr;
+    vector<int> unsortedKeys = {1, 3, 3, 5};
+    bool rejected = !builtTree.BuildFromSorted(unsortedKeys.begin(), unsortedKeys.end()) && builtTree.isEmpty();
+    report("Build From Sorted Test", builtOk && rejected);
+
+    // 14. Rebalancing relinks a degenerate tree in place, and an AVL tree stays usable afterwards
+    cout << "\n--- Rebalance Test ---" << endl;
+    for (int i = 0; i < listCount; ++i)
+    {
+        listTree.Insert(i);
+    }
+    int* firstItem = listTree.Search(0);
+    listTree.Rebalance();
+    bool listBalanced = listTree.GetHeight() == 15 && listTree.Search(0) == firstItem &&
+                        listTree.Search(listCount - 1) != nullptr;
+    randomTree.Rebalance();
+    for (int key = 0; key < 5000; key += 5)
+    {
+        randomTree.DeleteNode(key);
+        reference.erase(key);
+    }
+    for (int key = 5000; key < 6000; ++key)
+    {
+        randomTree.Insert(key);
+        reference.insert(key);
+    }
+    bool avlOk = vector<int>(randomTree.begin(), randomTree.end()) == vector<int>(reference.begin(), reference.end()) &&
+                 randomTree.GetHeight() <= avlHeightBound(static_cast<int>(reference.size()));
+    report("Rebalance Test", listBalanced && avlOk);
+
+    cout << "\n--- End of Bst Unit Tests ---" << endl;
+    return 0;
+}
@@ -1,10 +1,25 @@
 #include "Controller.h"
+#include "MappedFile.h"
+#include "RecordParser.h"
+#include "CsvTokenizer.h"
+#include "CsvScanner.h"
+#include "RecordCache.h"
+#include "RecordSource.h"
+#include "RecordSink.h"
+#include "RingBuffer.h"
+#include "InputFile.h"
 #include <fstream>
 #include <cmath>
 #include <iomanip>
 #include <string>
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using std::ifstream;
 using std::stringstream;
@@ -12,8 +27,6 @@ using std::fixed;
 using std::setprecision;
 using std::ofstream;
 using std::abs;
-using std::stoi;
-using std::stof;
 using std::getline;
 
 Vector<string> Controller::splitString(const string& s, char delimiter)
@@ -21,165 +34,675 @@ Vector<string> Controller::splitString(const string& s, char delimiter)
     Vector<string> tokens;
     string token;
     stringstream tokenStream(s);
-    int inc = 0;
     while (getline(tokenStream, token, delimiter))
     {
-        tokens.Insert(token, inc);
-        inc++;
+        tokens.PushBack(std::move(token));
     }
     return tokens;
 }
 
+void Controller::SetLoadMode(LoadMode mode)
+{
+    m_loadMode = mode;
+}
+
+LoadMode Controller::GetLoadMode() const
+{
+    return m_loadMode;
+}
+
+void Controller::SetChunkThreads(int threadCount)
+{
+    m_chunkThreads = (threadCount > 0) ? threadCount : 1;
+}
+
+int Controller::GetChunkThreads() const
+{
+    return m_chunkThreads;
+}
+
+void Controller::SetLoaderThreads(int threadCount)
+{
+    m_loaderThreads = (threadCount > 0) ? threadCount : 1;
+}
+
+int Controller::GetLoaderThreads() const
+{
+    return m_loaderThreads;
+}
+
+void Controller::SetSkipUnfinishedLine(bool skip)
+{
+    m_skipUnfinishedLine = skip;
+}
+
+bool Controller::GetSkipUnfinishedLine() const
+{
+    return m_skipUnfinishedLine;
+}
+
 int Controller::LoadRecords(WeatherDatabase& weatherRecords, const string & filename)
 {
-    int recordsLoaded = 0;
-    ifstream inFile(filename);
-    if (!inFile.is_open())
+    FileIngestStats stats;
+    stats.filename = filename;
+    int recordsLoaded = LoadRecords(weatherRecords, filename, stats);
+    cerr << stats.messages;
+    if (stats.GetRejectedCount() > 0)
     {
-        cerr << "Error: Could not open file " << filename << endl;
-        return -1;
+        IngestReport report;
+        report.AddFile(stats);
+        report.Print(cerr);
     }
+    return recordsLoaded;
+}
 
-    string headerLine;
-    if (!getline(inFile, headerLine))
+int Controller::LoadRecords(WeatherDatabase& weatherRecords, const string & filename, FileIngestStats& stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // Compressed files can only be streamed: inflate on the pipeline's reader thread
+    int recordsLoaded;
+    if (m_loadMode != LoadMode::Pipelined && InputFile::IsGzipFile(filename))
+    {
+        recordsLoaded = loadRecordsPipelined(weatherRecords, filename, stats);
+    }
+    else if (m_loadMode == LoadMode::Mapped)
+    {
+        recordsLoaded = loadRecordsMapped(weatherRecords, filename, stats);
+    }
+    else if (m_loadMode == LoadMode::Pipelined)
+    {
+        recordsLoaded = loadRecordsPipelined(weatherRecords, filename, stats);
+    }
+    else
     {
-        cerr << "Error: Could not read header line from file " << filename << endl;
-        inFile.close();
+        recordsLoaded = loadRecordsStream(weatherRecords, filename, stats);
+    }
+
+    stats.loaded = (recordsLoaded >= 0);
+    stats.rowsAccepted = (recordsLoaded >= 0) ? recordsLoaded : 0;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return recordsLoaded;
+}
+
+int Controller::loadRecordsStream(WeatherDatabase& weatherRecords, const string & filename, FileIngestStats& stats)
+{
+    // The source keeps one line buffer and a re-used field table, so after the
+    // first few rows parsing a line does not allocate.
+    CsvRecordSource source(filename, m_skipUnfinishedLine);
+    if (!source.IsOpen())
+    {
+        stats.messages += source.GetStats().messages;
         return -1;
     }
 
-    Vector<string> headers = splitString(headerLine, CSV_DELIMITER);
-    int dateTimeIndex = -1;
-    int windSpeedIndex = -1;
-    int tempIndex = -1;
-    int solarRadIndex = -1;
+    DatabaseSink sink(weatherRecords);
+    long recordsLoaded = PumpRecords(source, sink);
+    stats.Append(source.GetStats(), 0);
+    stats.followOffset = source.GetStats().followOffset;
+    return static_cast<int>(recordsLoaded);
+}
+
+// Smallest slice of a file worth handing to its own parser thread
+const size_t MIN_CHUNK_BYTES = 256 * 1024;
+
+// Bytes scanned into one structural index (rounded up to the next line end)
+const size_t SCAN_BLOCK_BYTES = 64 * 1024;
+
+/**
+ * @brief Records and warnings produced by parsing one byte range of a mapped file.
+ */
+struct ParsedChunk
+{
+    const char* begin = nullptr;     //!< First byte of the range (start of a line).
+    const char* end = nullptr;       //!< One past the last byte of the range.
+    Vector<WeatherRecord> records;   //!< Accepted records in file order.
+    FileIngestStats stats;           //!< Rejected rows, numbered from the start of the range.
+    long lineCount = 0;              //!< Lines in the range.
+};
+
+// Moves a split point forward to the start of the next line
+static const char* alignToLineStart(const char* p, const char* end)
+{
+    const char* lineEnd = RecordParser::FindLineEnd(p - 1, end);
+    return (lineEnd < end) ? lineEnd + 1 : end;
+}
+
+// Parses every line in [p, end), calling onRecord for accepted rows and
+// onIssue(status, line) for rejected ones, where line counts from 1 at p.
+// Returns the number of lines in the range.
+// The range is processed in blocks that end on a line boundary; for each block a
+// StructuralIndex of all delimiter/newline offsets is built with the vectorized
+// scanner, and rows are cut straight from that index.
+template <class RecordFunc, class IssueFunc>
+static long parseRows(const char* p, const char* end, const ColumnLayout& layout,
+                      RecordFunc onRecord, IssueFunc onIssue)
+{
+    CsvTokenizer tokenizer(CSV_DELIMITER);
+    StructuralIndex index;
+    WeatherRecord record;
+    long lineNumber = 0;
 
-    for (int i = 0; i < headers.getCount(); ++i)
+    // Tokenizes and parses the line [lineStart, lineEnd) of the current block
+    auto parseLine = [&](const char* block, uint32_t lineStart, uint32_t lineEnd,
+                         const uint32_t* delimiters, int delimiterCount)
     {
-        string header = headers[i];
+        tokenizer.TokenizeIndexed(block, lineStart, lineEnd, delimiters, delimiterCount);
+        lineNumber++;
 
-        if (header == DATE_TIME_COLUMN)
+        RowStatus status = RecordParser::ParseRow(tokenizer, layout, record);
+        if (status == RowStatus::Ok)
+        {
+            onRecord(record);
+        }
+        else
         {
-            dateTimeIndex = i;
+            onIssue(status, lineNumber);
         }
+    };
+
+    while (p < end)
+    {
+        const char* blockEnd = (static_cast<size_t>(end - p) > SCAN_BLOCK_BYTES)
+                               ? alignToLineStart(p + SCAN_BLOCK_BYTES, end) : end;
+        uint32_t blockLength = static_cast<uint32_t>(blockEnd - p);
 
-        if (header == WIND_SPEED_COLUMN)
+        size_t count = index.Build(p, blockLength, CSV_DELIMITER);
+        const uint32_t* positions = index.GetPositions();
+
+        uint32_t lineStart = 0;
+        size_t firstDelimiter = 0;
+        for (size_t i = 0; i < count; ++i)
         {
-            windSpeedIndex = i;
+            if (p[positions[i]] == '\n')
+            {
+                parseLine(p, lineStart, positions[i], positions + firstDelimiter, static_cast<int>(i - firstDelimiter));
+                lineStart = positions[i] + 1;
+                firstDelimiter = i + 1;
+            }
         }
 
-        if (header == AIR_TEMP_COLUMN)
+        // Last line of the range without a trailing newline
+        if (lineStart < blockLength)
         {
-            tempIndex = i;
+            parseLine(p, lineStart, blockLength, positions + firstDelimiter, static_cast<int>(count - firstDelimiter));
         }
 
-        if (header == SOLAR_RAD_COLUMN)
+        p = blockEnd;
+    }
+    return lineNumber;
+}
+
+int Controller::loadRecordsMapped(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats)
+{
+    MappedFile file;
+    if (!file.Open(filename))
+    {
+        stats.AddMessage("Error: Could not open file " + filename);
+        return -1;
+    }
+
+    const char* p = file.GetData();
+    const char* end = p + file.GetSize();
+    stats.bytes += file.GetSize();
+    if (p == end)
+    {
+        stats.AddMessage("Error: Could not read header line from file " + filename);
+        return -1;
+    }
+
+    // --- 1. Resolve column positions from the header (shared by every chunk) ---
+    const char* lineEnd = RecordParser::FindLineEnd(p, end);
+    CsvTokenizer headerTokenizer(CSV_DELIMITER);
+    headerTokenizer.Tokenize(string_view(p, static_cast<size_t>(lineEnd - p)));
+    ColumnLayout layout;
+    if (!RecordParser::ResolveColumns(headerTokenizer, layout))
+    {
+        stats.AddMessage("Error: One or more required columns ('WAST', 'S', 'T', 'SR') not found in the header.");
+        return -1;
+    }
+    const char* body = (lineEnd < end) ? lineEnd + 1 : end;
+
+    // Where the complete lines end; a final line without its newline may still be being written
+    const char* completeEnd = end;
+    while (completeEnd > body && completeEnd[-1] != '\n')
+    {
+        completeEnd--;
+    }
+    stats.followOffset = (lineEnd < end) ? static_cast<uint64_t>(completeEnd - file.GetData()) : 0;
+    if (m_skipUnfinishedLine)
+    {
+        end = completeEnd;
+    }
+
+    size_t bodySize = static_cast<size_t>(end - body);
+    int chunkCount = static_cast<int>(std::min<size_t>(m_chunkThreads, bodySize / MIN_CHUNK_BYTES));
+
+    // --- 2a. Small files: parse each row straight out of the mapped bytes ---
+    int recordsLoaded = 0;
+    if (chunkCount <= 1)
+    {
+        parseRows(body, end, layout,
+                  [&](const WeatherRecord& record)
+        {
+            weatherRecords.Insert(record);
+            recordsLoaded++;
+        },
+        [&stats](RowStatus status, long line)
+        {
+            stats.AddIssue(status, line + 1); // Line 1 is the header
+        });
+        return recordsLoaded;
+    }
+
+    // --- 2b. Large files: split into newline-aligned byte ranges parsed concurrently ---
+    std::unique_ptr<ParsedChunk[]> chunks(new ParsedChunk[chunkCount]);
+    const char* chunkStart = body;
+    for (int i = 0; i < chunkCount; ++i)
+    {
+        const char* chunkEnd = (i == chunkCount - 1) ? end : alignToLineStart(body + bodySize * (i + 1) / chunkCount, end);
+        if (chunkEnd < chunkStart)
+        {
+            chunkEnd = chunkStart;
+        }
+        chunks[i].begin = chunkStart;
+        chunks[i].end = chunkEnd;
+        chunkStart = chunkEnd;
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < chunkCount; ++i)
+    {
+        workers.emplace_back([&layout](ParsedChunk* chunk)
+        {
+            chunk->lineCount = parseRows(chunk->begin, chunk->end, layout,
+                                         [chunk](const WeatherRecord& record)
+            {
+                chunk->records.PushBack(record);
+            },
+            [chunk](RowStatus status, long line)
+            {
+                chunk->stats.AddIssue(status, line);
+            });
+        }, &chunks[i]);
+    }
+    for (std::thread& t : workers)
+    {
+        t.join();
+    }
+
+    // --- 3. Insert the chunks back in original row order ---
+    long lineOffset = 1; // The header
+    for (int i = 0; i < chunkCount; ++i)
+    {
+        stats.Append(chunks[i].stats, lineOffset);
+        lineOffset += chunks[i].lineCount;
+        for (int r = 0; r < chunks[i].records.getCount(); ++r)
+        {
+            weatherRecords.Insert(chunks[i].records[r]);
+        }
+        recordsLoaded += chunks[i].records.getCount();
+    }
+
+    return recordsLoaded;
+}
+
+// Bytes the pipeline reader pulls from disk per text block (extended to the next line end)
+const size_t READ_BLOCK_BYTES = 1024 * 1024;
+
+// Bytes read at a time while looking for the end of the header line
+const size_t HEADER_READ_BYTES = 64 * 1024;
+
+// Cells in each pipeline queue; bounds the text and parsed blocks in flight
+const size_t PIPELINE_QUEUE_CAPACITY = 8;
+
+// Blocks read but not yet inserted, at least; more with many parser workers. Bounds the
+// memory held by a slow block and sizes the inserter's reorder ring.
+const int MIN_BLOCKS_IN_FLIGHT = 8;
+
+/**
+ * @brief Whole lines of a file read by the pipeline reader stage.
+ */
+struct TextBlock
+{
+    uint64_t sequence = 0; //!< Position of the block in the file.
+    string text;           //!< Complete lines, newline-terminated except possibly the last of the file.
+};
+
+/**
+ * @brief Parser stage output for one TextBlock.
+ */
+struct ParsedBlock
+{
+    uint64_t sequence = 0;         //!< Sequence of the source TextBlock.
+    Vector<WeatherRecord> records; //!< Accepted records in file order.
+    FileIngestStats stats;         //!< Rejected rows, numbered from the start of the block.
+    long lineCount = 0;            //!< Lines in the block.
+};
+
+/**
+ * @brief Work and time counters of the pipelined loader, used for the stage report.
+ */
+struct PipelineStats
+{
+    uint64_t bytesRead = 0;                   //!< Reader: bytes read from disk.
+    double readSeconds = 0.0;                 //!< Reader: time spent in read calls.
+    std::atomic<uint64_t> rowsParsed{0};      //!< Parsers: accepted rows.
+    std::atomic<int64_t> parseNanoseconds{0}; //!< Parsers: summed busy time of all workers.
+    uint64_t rowsInserted = 0;                //!< Inserter: rows inserted into the database.
+    double insertSeconds = 0.0;               //!< Inserter: time spent inserting.
+    uint64_t textSamples = 0;                 //!< Occupancy samples of the text queue.
+    uint64_t textOccupancy = 0;               //!< Sum of those samples.
+    std::atomic<uint64_t> parsedSamples{0};   //!< Occupancy samples of the parsed queue.
+    std::atomic<uint64_t> parsedOccupancy{0}; //!< Sum of those samples.
+};
+
+// Seconds elapsed since start
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Keeps the reason an InputFile failed, if it gave one
+static void addInputError(const InputFile& file, FileIngestStats& stats)
+{
+    if (!file.GetError().empty())
+    {
+        stats.AddMessage(file.GetError());
+    }
+}
+
+// Formats per-stage throughput (work / busy time) and the mean queue length seen by each
+// producer just before a push; a queue that stays near full sits in front of the bottleneck
+static string formatPipelineStats(const PipelineStats& stats, int parserCount, size_t queueCapacity, bool compressed)
+{
+    double parseSeconds = stats.parseNanoseconds.load() / 1e9;
+    std::ostringstream out;
+
+    out << fixed << setprecision(1)
+         << "Pipeline: " << (compressed ? "inflate " : "read ") << (stats.readSeconds > 0 ? stats.bytesRead / 1e6 / stats.readSeconds : 0.0) << " MB/s"
+         << ", parse " << (parseSeconds > 0 ? stats.rowsParsed.load() / 1e3 / parseSeconds : 0.0)
+         << "k rows/s per worker (" << parserCount << " workers)"
+         << ", insert " << (stats.insertSeconds > 0 ? stats.rowsInserted / 1e3 / stats.insertSeconds : 0.0) << "k rows/s"
+         << "; queue occupancy text "
+         << (stats.textSamples > 0 ? double(stats.textOccupancy) / stats.textSamples : 0.0) << "/" << queueCapacity
+         << ", parsed "
+         << (stats.parsedSamples > 0 ? double(stats.parsedOccupancy.load()) / stats.parsedSamples.load() : 0.0) << "/" << queueCapacity;
+    return out.str();
+}
+
+int Controller::loadRecordsPipelined(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats)
+{
+    // Plain and gzip files look the same from here on
+    InputFile inFile;
+    if (!inFile.Open(filename))
+    {
+        addInputError(inFile, stats);
+        stats.AddMessage("Error: Could not open file " + filename);
+        return -1;
+    }
+
+    // Read until the end of the header line; the rest is the start of the first block
+    string carry;
+    size_t headerEnd = string::npos;
+    long got = 0;
+    while (headerEnd == string::npos)
+    {
+        size_t kept = carry.size();
+        carry.resize(kept + HEADER_READ_BYTES);
+        got = inFile.Read(&carry[kept], HEADER_READ_BYTES);
+        carry.resize(kept + (got > 0 ? static_cast<size_t>(got) : 0));
+        headerEnd = carry.find('\n', kept);
+        if (got < static_cast<long>(HEADER_READ_BYTES))
         {
-            solarRadIndex = i;
+            break;
         }
     }
+    if (got < 0 || carry.empty())
+    {
+        addInputError(inFile, stats);
+        stats.AddMessage("Error: Could not read header line from file " + filename);
+        return -1;
+    }
+    string headerLine = carry.substr(0, headerEnd);
+    carry.erase(0, (headerEnd == string::npos) ? carry.size() : headerEnd + 1);
 
-    // --- 2. Validation ---
-    if (dateTimeIndex == -1 || windSpeedIndex == -1 || tempIndex == -1 || solarRadIndex == -1)
+    CsvTokenizer headerTokenizer(CSV_DELIMITER);
+    headerTokenizer.Tokenize(headerLine);
+    ColumnLayout layout;
+    if (!RecordParser::ResolveColumns(headerTokenizer, layout))
     {
-        cerr << "Error: One or more required columns ('WAST', 'S', 'T', 'SR') not found in the header." << endl;
-        inFile.close();
+        stats.AddMessage("Error: One or more required columns ('WAST', 'S', 'T', 'SR') not found in the header.");
         return -1;
     }
 
-    // --- 3. Process Data Lines ---
-    string line;
-    while(getline(inFile, line))
+    uint64_t carryBytes = carry.size();
+
+    // A null text block tells a parser worker to stop; it answers with a null parsed block
+    int parserCount = m_chunkThreads;
+    int window = std::max(MIN_BLOCKS_IN_FLIGHT, 2 * parserCount);
+    RingBuffer<std::unique_ptr<TextBlock>> textQueue(PIPELINE_QUEUE_CAPACITY);
+    RingBuffer<std::unique_ptr<ParsedBlock>> parsedQueue(PIPELINE_QUEUE_CAPACITY);
+
+    // One token per block allowed in flight: the reader takes one per block, the inserter
+    // returns it once that block is inserted, so at most `window` blocks wait to be put in order
+    RingBuffer<int> windowTokens(static_cast<size_t>(window));
+    for (int i = 0; i < window; ++i)
     {
-        Vector<string> tokens = splitString(line, CSV_DELIMITER);
-        WeatherRecord record;
+        windowTokens.Push(i);
+    }
+
+    PipelineStats pipeline;
+    size_t unfinishedBytes = 0; // Final line of the file without its newline
+    bool readFailed = false;
 
-        // Skip lines that don't have enough data
-        if (tokens.getCount() < headers.getCount())
+    // --- Stage 1: reader. Fills large buffers and cuts them after the last newline ---
+    std::thread reader([&]()
+    {
+        uint64_t sequence = 0;
+        bool atEnd = false; // carry holds the partial line left over from the previous block
+        while (!atEnd)
         {
-            continue;
+            std::unique_ptr<TextBlock> block(new TextBlock());
+            block->text.swap(carry);
+            size_t kept = block->text.size();
+            block->text.resize(kept + READ_BLOCK_BYTES);
+
+            auto start = std::chrono::steady_clock::now();
+            long result = inFile.Read(&block->text[kept], READ_BLOCK_BYTES);
+            readFailed = (result < 0);
+            size_t got = readFailed ? 0 : static_cast<size_t>(result);
+            pipeline.readSeconds += secondsSince(start);
+            pipeline.bytesRead += got;
+
+            block->text.resize(kept + got);
+            atEnd = (got < READ_BLOCK_BYTES);
+            if (!atEnd)
+            {
+                size_t lastNewline = block->text.rfind('\n');
+                if (lastNewline == string::npos)
+                {
+                    carry.swap(block->text); // One line longer than a block: keep reading
+                    continue;
+                }
+                carry.assign(block->text, lastNewline + 1, string::npos);
+                block->text.resize(lastNewline + 1);
+            }
+            else
+            {
+                size_t lastNewline = block->text.rfind('\n');
+                unfinishedBytes = block->text.size() - ((lastNewline == string::npos) ? 0 : lastNewline + 1);
+                if (m_skipUnfinishedLine)
+                {
+                    block->text.resize(block->text.size() - unfinishedBytes);
+                }
+            }
+            if (block->text.empty())
+            {
+                continue;
+            }
+
+            int token;
+            windowTokens.Pop(token); // Wait while the inserter is `window` blocks behind
+
+            block->sequence = sequence++;
+            pipeline.textOccupancy += textQueue.GetSize();
+            pipeline.textSamples++;
+            textQueue.Push(block);
         }
 
-        // --- A. Parse Date/Time (D/M/Y H:M - 24hr format) ---
-        string dateTimeStr = tokens[dateTimeIndex];
-
-        // assuming date time separated by a space
-        size_t spacePos = dateTimeStr.find_first_of(' ');
-        if (spacePos == string::npos)
-            continue; // Skip if no space found
-
-        string datePart = dateTimeStr.substr(0, spacePos);
-        string timePart = dateTimeStr.substr(spacePos + 1); // Skip the space
-
-        // 1. Parse Date (D/M/Y)
-        stringstream dateStream(datePart);
-        string tempStr;
-        int day, month, year;
-
-        // Get Day, Month, Year
-        getline(dateStream, tempStr, DATE_DELIMITER);
-        day = stoi(tempStr);
-        getline(dateStream, tempStr, DATE_DELIMITER);
-        month = stoi(tempStr);
-        getline(dateStream, tempStr);
-        year = stoi(tempStr);
-        Date recordDate(day, month, year);
-        record.SetDate(recordDate);
-
-        // 2. Parse Time (H:M)
-        stringstream timeStream(timePart);
-        int hour, minute, second;
-
-        // Get Hour, Minute
-        getline(timeStream, tempStr, TIME_DELIMITER);
-        hour = stoi(tempStr);
-        getline(timeStream, tempStr, TIME_DELIMITER);
-        minute = stoi(tempStr);
-        getline(timeStream, tempStr);
-        second = stoi(tempStr);
-
-        Time recordTime(hour, minute, second);
-        record.SetTime(recordTime);
-
-        // --- B. Parse Data Values ---
-        try
-        {
-            // Wind Speed (S): Assumed in m/s, converted to km/h (multiplying by 3.6)
-            record.SetWindSpeed(std::stof(tokens[windSpeedIndex]) * 3.6f);
-
-            // Temperature (T)
-            record.SetTemperature(std::stof(tokens[tempIndex]));
-
-            // Solar Radiation (SR)
-            // Record taken 10min apart
-            double time_step = 10.0 / 60.0;
-            // Convert power (W/m2) to energy (Wh/m2) by multiplying by the time step
-            double srEnergy = std::stof(tokens[solarRadIndex]) * time_step;
-            // Convert Wh/m2 to kWh/m2
-            double srEnergyK = srEnergy / 1000.0;
-            record.SetSolarRadiation(srEnergyK);
-        }
-        catch (const std::invalid_argument& e)
-        {
-            cerr << "Warning: Skipped record due to non-numeric data fields: " << line << endl;
-            continue;
+        for (int i = 0; i < parserCount; ++i)
+        {
+            std::unique_ptr<TextBlock> stop;
+            textQueue.Push(stop);
         }
-        catch (const std::out_of_range& e)
+    });
+
+    // --- Stage 2: parser workers. Blocks may finish out of order ---
+    std::vector<std::thread> parsers;
+    for (int i = 0; i < parserCount; ++i)
+    {
+        parsers.emplace_back([&]()
+        {
+            std::unique_ptr<TextBlock> block;
+            while (true)
+            {
+                textQueue.Pop(block);
+                if (!block)
+                {
+                    std::unique_ptr<ParsedBlock> done;
+                    parsedQueue.Push(done);
+                    return;
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                std::unique_ptr<ParsedBlock> parsed(new ParsedBlock());
+                parsed->sequence = block->sequence;
+                ParsedBlock* out = parsed.get();
+                const char* begin = block->text.data();
+                out->lineCount = parseRows(begin, begin + block->text.size(), layout,
+                                           [out](const WeatherRecord& record)
+                {
+                    out->records.PushBack(record);
+                },
+                [out](RowStatus status, long line)
+                {
+                    out->stats.AddIssue(status, line);
+                });
+                pipeline.rowsParsed += static_cast<uint64_t>(parsed->records.getCount());
+                pipeline.parseNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now() - start).count();
+                block.reset();
+
+                pipeline.parsedOccupancy += parsedQueue.GetSize();
+                pipeline.parsedSamples++;
+                parsedQueue.Push(parsed);
+            }
+        });
+    }
+
+    // --- Stage 3: inserter (this thread). Restores file order by sequence number ---
+    // Blocks in flight have sequences in [nextSequence, nextSequence + window), so each has its own slot
+    std::vector<std::unique_ptr<ParsedBlock>> reorder(static_cast<size_t>(window));
+    uint64_t nextSequence = 0;
+    long lineOffset = 1; // The header
+    int recordsLoaded = 0;
+    int workersDone = 0;
+    while (workersDone < parserCount)
+    {
+        std::unique_ptr<ParsedBlock> parsed;
+        parsedQueue.Pop(parsed);
+        if (!parsed)
         {
-            cerr << "Warning: Skipped record due to numeric value out of range: " << line << endl;
+            workersDone++; // Each worker sends its last block before it stops
             continue;
         }
 
-        // --- C. Store Record ---
-        weatherRecords.Insert(record);
-        recordsLoaded++;
+        reorder[parsed->sequence % window] = std::move(parsed);
+
+        while (reorder[nextSequence % window])
+        {
+            std::unique_ptr<ParsedBlock>& slot = reorder[nextSequence % window];
+            ParsedBlock& ready = *slot;
+            stats.Append(ready.stats, lineOffset);
+            lineOffset += ready.lineCount;
+
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < ready.records.getCount(); ++r)
+            {
+                weatherRecords.Insert(ready.records[r]);
+            }
+            pipeline.insertSeconds += secondsSince(start);
+            pipeline.rowsInserted += static_cast<uint64_t>(ready.records.getCount());
+            recordsLoaded += ready.records.getCount();
+
+            slot.reset();
+            nextSequence++;
+            int token = 0;
+            windowTokens.Push(token);
+        }
+    }
+
+    reader.join();
+    for (std::thread& t : parsers)
+    {
+        t.join();
     }
 
-    inFile.close();
+    if (readFailed)
+    {
+        addInputError(inFile, stats);
+        stats.AddMessage("Error: Could not read all of " + filename + "; keeping the rows read before the error.");
+    }
+    uint64_t fileBytes = headerLine.size() + 1 + carryBytes + pipeline.bytesRead;
+    stats.bytes += fileBytes;
+    stats.followOffset = (headerEnd == string::npos) ? 0 : fileBytes - unfinishedBytes;
+    if (m_loadMode == LoadMode::Pipelined)
+    {
+        stats.AddMessage(formatPipelineStats(pipeline, parserCount, textQueue.GetCapacity(), inFile.IsCompressed()));
+    }
     return recordsLoaded;
 }
 
+// Runs loadFile(i) for every file index on a pool of workerCount threads. Each worker
+// repeatedly claims the next unloaded file, so long and short files balance out.
+template <class LoadFunc>
+static void runFileWorkers(int workerCount, int fileCount, LoadFunc loadFile)
+{
+    std::atomic<int> nextFile(0);
+    auto worker = [&]()
+    {
+        int index;
+        while ((index = nextFile.fetch_add(1)) < fileCount)
+        {
+            loadFile(index);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+    for (std::thread& t : workers)
+    {
+        t.join();
+    }
+}
+
 int Controller::LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, const string& sourceFilename)
+{
+    IngestReport report;
+    int totalRecordsLoaded = LoadAllRecordsFromSourceFile(weatherRecords, sourceFilename, report);
+    if (report.getCount() > 0)
+    {
+        report.Print(cerr);
+    }
+    return totalRecordsLoaded;
+}
+
+int Controller::LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, const string& sourceFilename,
+                                             IngestReport& report)
 {
     ifstream sourceFile(sourceFilename);
     if (!sourceFile.is_open())
@@ -188,31 +711,70 @@ int Controller::LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, co
         return -1;
     }
 
+    // read filenames line by line from the source file
+    Vector<string> filenames;
     string filename;
+    while (getline(sourceFile, filename))
+    {
+        filenames.PushBack(filename);
+    }
+    sourceFile.close();
+
+    int fileCount = filenames.getCount();
     int totalRecordsLoaded = 0;
     int filesProcessed = 0;
-
-    // read filenames line by line from the source file
-    while (getline(sourceFile, filename))
+    std::unique_ptr<FileIngestStats[]> fileStats(new FileIngestStats[fileCount > 0 ? fileCount : 1]);
+    for (int i = 0; i < fileCount; ++i)
     {
-        cout << "Loading data from: " << filename << "... ";
+        fileStats[i].filename = filenames[i];
+    }
 
-        // call LoadRecords function for the current file
-        int recordsFromFile = LoadRecords(weatherRecords, "data/" + filename);
+    if (m_loaderThreads > 1 && fileCount > 1)
+    {
+        // Parse every file into its own partial database, then merge them in list order.
+        // Each file's errors are held back and printed after its banner, as the sequential loader does.
+        // Each partial lives in its own arena, which is dropped in one go once merged.
+        std::unique_ptr<Arena[]> arenas(new Arena[fileCount]);
+        std::vector<WeatherDatabase> partials;
+        partials.reserve(fileCount);
+        for (int i = 0; i < fileCount; ++i)
+        {
+            partials.emplace_back(&arenas[i]);
+        }
+        std::unique_ptr<int[]> recordCounts(new int[fileCount]);
+        loadFilesParallel(filenames, partials.data(), recordCounts.get(), fileStats.get());
 
-        if (recordsFromFile >= 0)
+        for (int i = 0; i < fileCount; ++i)
         {
-            totalRecordsLoaded += recordsFromFile;
-            filesProcessed++;
-            cout << recordsFromFile << " records loaded." << endl;
+            cout << "Loading data from: " << filenames[i] << "... ";
+            cerr << fileStats[i].messages;
+            if (tallyFileResult(filenames[i], recordCounts[i], totalRecordsLoaded, filesProcessed))
+            {
+                weatherRecords.Merge(partials[i]);
+            }
+            partials[i] = WeatherDatabase();
+            arenas[i].Release();
         }
-        else
+    }
+    else
+    {
+        for (int i = 0; i < fileCount; ++i)
         {
-            cerr << "ERROR: Failed to load data from " << filename << ". Skipping file." << endl;
+            cout << "Loading data from: " << filenames[i] << "... ";
+
+            // call LoadRecords function for the current file
+            int recordsFromFile = LoadRecords(weatherRecords, DATA_FOLDER + filenames[i], fileStats[i]);
+            cerr << fileStats[i].messages;
+            tallyFileResult(filenames[i], recordsFromFile, totalRecordsLoaded, filesProcessed);
         }
     }
 
-    sourceFile.close();
+    weatherRecords.FinishLoading();
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        report.AddFile(fileStats[i]);
+    }
 
     if (filesProcessed == 0 && totalRecordsLoaded == 0)
     {
@@ -225,3 +787,245 @@ int Controller::LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, co
 
     return totalRecordsLoaded;
 }
+
+int Controller::LoadSensorColumns(SensorFrame& frame, const string& filename, FileIngestStats& stats)
+{
+    // Compressed files cannot be mapped; the stream loader inflates them as it reads
+    int rowsLoaded;
+    if (m_loadMode == LoadMode::Mapped && !InputFile::IsGzipFile(filename))
+    {
+        rowsLoaded = loadSensorColumnsMapped(frame, filename, stats);
+    }
+    else
+    {
+        rowsLoaded = loadSensorColumnsStream(frame, filename, stats);
+    }
+
+    stats.loaded = (rowsLoaded >= 0);
+    stats.rowsAccepted = (rowsLoaded >= 0) ? rowsLoaded : 0;
+    return rowsLoaded;
+}
+
+int Controller::loadSensorColumnsStream(SensorFrame& frame, const string& filename, FileIngestStats& stats)
+{
+    InputFile inFile;
+    if (!inFile.Open(filename))
+    {
+        addInputError(inFile, stats);
+        stats.AddMessage("Error: Could not open file " + filename);
+        return -1;
+    }
+
+    string line;
+    if (!inFile.ReadLine(line))
+    {
+        addInputError(inFile, stats);
+        stats.AddMessage("Error: Could not read header line from file " + filename);
+        return -1;
+    }
+
+    const SensorSchema& schema = frame.GetSchema();
+    CsvTokenizer tokenizer(CSV_DELIMITER);
+    tokenizer.Tokenize(line);
+    SchemaLayout layout;
+    if (!schema.ResolveColumns(tokenizer, layout))
+    {
+        stats.AddMessage("Error: 'WAST' or a requested sensor column was not found in the header of " + filename);
+        return -1;
+    }
+
+    stats.bytes += line.size() + 1;
+    int rowsLoaded = 0;
+    long lineNumber = 1;
+    Date date;
+    Time time;
+    float values[SENSOR_COUNT];
+    while (inFile.ReadLine(line))
+    {
+        lineNumber++;
+        stats.bytes += line.size() + 1;
+        tokenizer.Tokenize(line);
+
+        RowStatus status = schema.ParseRow(tokenizer, layout, date, time, values);
+        if (status != RowStatus::Ok)
+        {
+            stats.AddIssue(status, lineNumber);
+            continue;
+        }
+
+        frame.Append(date, time, values);
+        rowsLoaded++;
+    }
+    addInputError(inFile, stats);
+    return rowsLoaded;
+}
+
+int Controller::loadSensorColumnsMapped(SensorFrame& frame, const string& filename, FileIngestStats& stats)
+{
+    MappedFile file;
+    if (!file.Open(filename))
+    {
+        stats.AddMessage("Error: Could not open file " + filename);
+        return -1;
+    }
+
+    const char* p = file.GetData();
+    const char* end = p + file.GetSize();
+    stats.bytes += file.GetSize();
+    if (p == end)
+    {
+        stats.AddMessage("Error: Could not read header line from file " + filename);
+        return -1;
+    }
+
+    const SensorSchema& schema = frame.GetSchema();
+    const char* lineEnd = RecordParser::FindLineEnd(p, end);
+    CsvTokenizer tokenizer(CSV_DELIMITER);
+    tokenizer.Tokenize(string_view(p, static_cast<size_t>(lineEnd - p)));
+    SchemaLayout layout;
+    if (!schema.ResolveColumns(tokenizer, layout))
+    {
+        stats.AddMessage("Error: 'WAST' or a requested sensor column was not found in the header of " + filename);
+        return -1;
+    }
+
+    // Rows are tokenized straight out of the mapped bytes
+    int rowsLoaded = 0;
+    long lineNumber = 1;
+    Date date;
+    Time time;
+    float values[SENSOR_COUNT];
+    for (p = (lineEnd < end) ? lineEnd + 1 : end; p < end; p = (lineEnd < end) ? lineEnd + 1 : end)
+    {
+        lineEnd = RecordParser::FindLineEnd(p, end);
+        lineNumber++;
+        tokenizer.Tokenize(string_view(p, static_cast<size_t>(lineEnd - p)));
+
+        RowStatus status = schema.ParseRow(tokenizer, layout, date, time, values);
+        if (status != RowStatus::Ok)
+        {
+            stats.AddIssue(status, lineNumber);
+            continue;
+        }
+
+        frame.Append(date, time, values);
+        rowsLoaded++;
+    }
+    return rowsLoaded;
+}
+
+int Controller::LoadAllSensorColumnsFromSourceFile(SensorFrame& frame, const string& sourceFilename)
+{
+    ifstream sourceFile(sourceFilename);
+    if (!sourceFile.is_open())
+    {
+        cerr << "Error: Could not open source file: " << sourceFilename << endl;
+        return -1;
+    }
+
+    Vector<string> filenames;
+    string filename;
+    while (getline(sourceFile, filename))
+    {
+        filenames.PushBack(filename);
+    }
+    sourceFile.close();
+
+    int fileCount = filenames.getCount();
+    std::unique_ptr<FileIngestStats[]> fileStats(new FileIngestStats[fileCount > 0 ? fileCount : 1]);
+    std::unique_ptr<int[]> rowCounts(new int[fileCount > 0 ? fileCount : 1]);
+
+    // Loads one listed file into target, timing it
+    auto loadFile = [&](int index, SensorFrame& target)
+    {
+        fileStats[index].filename = filenames[index];
+        auto start = std::chrono::steady_clock::now();
+        rowCounts[index] = LoadSensorColumns(target, DATA_FOLDER + filenames[index], fileStats[index]);
+        fileStats[index].seconds = secondsSince(start);
+    };
+
+    if (m_loaderThreads > 1 && fileCount > 1)
+    {
+        // Like LoadAllRecordsFromSourceFile: one partial frame per file, appended in list order
+        std::vector<std::unique_ptr<SensorFrame>> partials;
+        for (int i = 0; i < fileCount; ++i)
+        {
+            partials.emplace_back(new SensorFrame(frame.GetSchema()));
+        }
+        runFileWorkers(std::min(m_loaderThreads, fileCount), fileCount, [&](int index)
+        {
+            loadFile(index, *partials[index]);
+        });
+
+        for (int i = 0; i < fileCount; ++i)
+        {
+            if (rowCounts[i] > 0)
+            {
+                frame.AppendFrame(*partials[i]);
+            }
+            partials[i].reset();
+        }
+    }
+    else
+    {
+        for (int i = 0; i < fileCount; ++i)
+        {
+            loadFile(i, frame);
+        }
+    }
+
+    IngestReport report;
+    int totalRowsLoaded = 0;
+    for (int i = 0; i < fileCount; ++i)
+    {
+        cerr << fileStats[i].messages;
+        if (rowCounts[i] > 0)
+        {
+            totalRowsLoaded += rowCounts[i];
+        }
+        report.AddFile(fileStats[i]);
+    }
+    report.Print(cerr);
+    return totalRowsLoaded;
+}
+
+int Controller::LoadAllRecordsCached(WeatherDatabase& weatherRecords, const string& sourceFilename, const string& cacheFilename)
+{
+    int cachedRecords = RecordCache::Load(weatherRecords, cacheFilename, sourceFilename);
+    if (cachedRecords >= 0)
+    {
+        cout << "Loaded " << cachedRecords << " records from cache " << cacheFilename << endl;
+        return cachedRecords;
+    }
+
+    int totalRecordsLoaded = LoadAllRecordsFromSourceFile(weatherRecords, sourceFilename);
+    if (totalRecordsLoaded > 0)
+    {
+        RecordCache::Save(weatherRecords, cacheFilename, sourceFilename); // Prints why if it cannot
+    }
+    return totalRecordsLoaded;
+}
+
+bool Controller::tallyFileResult(const string& filename, int recordsFromFile, int& totalRecordsLoaded, int& filesProcessed)
+{
+    if (recordsFromFile >= 0)
+    {
+        totalRecordsLoaded += recordsFromFile;
+        filesProcessed++;
+        cout << recordsFromFile << " records loaded." << endl;
+        return true;
+    }
+
+    cerr << "ERROR: Failed to load data from " << filename << ". Skipping file." << endl;
+    return false;
+}
+
+void Controller::loadFilesParallel(const Vector<string>& filenames, WeatherDatabase* partials, int* recordCounts,
+                                   FileIngestStats* fileStats)
+{
+    int fileCount = filenames.getCount();
+    runFileWorkers(std::min(m_loaderThreads, fileCount), fileCount, [&](int index)
+    {
+        recordCounts[index] = LoadRecords(partials[index], DATA_FOLDER + filenames[index], fileStats[index]);
+    });
+}
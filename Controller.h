@@ -4,6 +4,8 @@
 #include "Types.h"
 #include "Statistics.h"
 #include "Menu.h"
+#include "SensorFrame.h"
+#include "IngestReport.h"
 
 #include <string>
 #include <iostream>
@@ -12,6 +14,17 @@
 using std::string;
 using std::cerr;
 
+/**
+ * @enum LoadMode
+ * @brief Selects how CSV files are read by Controller::LoadRecords.
+ */
+enum class LoadMode
+{
+    Stream, //!< Line by line through an ifstream (original loader).
+    Mapped,   //!< Memory-mapped file parsed in place without per-line allocations.
+    Pipelined //!< Reader, parser workers and inserter on separate threads joined by bounded queues.
+};
+
 /**
  * @class Controller
  * @brief Defines the Controller class, handling I/O, menu, user input validation,
@@ -20,27 +33,172 @@ using std::cerr;
 class Controller
 {
 public:
+    Controller() : m_loadMode(LoadMode::Stream), m_loaderThreads(1), m_chunkThreads(1), m_skipUnfinishedLine(false) {}
+
+    /**
+     * @brief Selects the file reading strategy used by LoadRecords.
+     * @param mode LoadMode::Stream (default) or LoadMode::Mapped.
+     */
+    void SetLoadMode(LoadMode mode);
+
+    /**
+     * @brief Gets the current file reading strategy.
+     * @return The active LoadMode.
+     */
+    LoadMode GetLoadMode() const;
+
+    /**
+     * @brief Sets how many worker threads LoadAllRecordsFromSourceFile uses.
+     * With more than one thread the listed files are parsed concurrently into
+     * per-file partial databases which are merged in list order afterwards.
+     * @param threadCount Number of worker threads; values below 1 mean sequential loading.
+     */
+    void SetLoaderThreads(int threadCount);
+
+    /**
+     * @brief Gets the number of worker threads used for multi-file loading.
+     * @return The configured thread count (1 = sequential).
+     */
+    int GetLoaderThreads() const;
+
+    /**
+     * @brief Sets how many threads parse a single file (LoadMode::Mapped and LoadMode::Pipelined).
+     * Mapped: the file body is split into byte ranges aligned to line starts, each range is
+     * parsed on its own thread, and the records are inserted in original row order.
+     * Files too small to be worth splitting are still parsed on one thread.
+     * Pipelined: the number of parser workers between the reader and the inserter.
+     * @param threadCount Number of parser threads per file; values below 1 mean 1.
+     */
+    void SetChunkThreads(int threadCount);
+
+    /**
+     * @brief Gets the number of parser threads used per file.
+     * @return The configured thread count (1 = no splitting).
+     */
+    int GetChunkThreads() const;
+
+    /**
+     * @brief Sets whether the loaders leave a final line without its '\n' unparsed.
+     * Use it when the files are followed afterwards (see FileFollower): the writer may still be
+     * adding to that line, and the follower reads it from FileIngestStats::followOffset once it is finished.
+     * @param skip true to skip an unfinished last line; false (default) parses it like any other row.
+     */
+    void SetSkipUnfinishedLine(bool skip);
+
+    /**
+     * @brief Checks whether the loaders skip an unfinished last line.
+     * @return The value set by SetSkipUnfinishedLine.
+     */
+    bool GetSkipUnfinishedLine() const;
+
     /**
      * @brief Loads weather records from a specified file into the WeatherDatabase container.
+     * Dispatches to the stream, memory-mapped or pipelined loader depending on the LoadMode.
+     * Gzip-compressed files (detected by their magic bytes) always use the pipelined
+     * loader, which inflates them on its reader thread while the parsers work.
+     * Errors and rejected rows are printed on cerr once the file is loaded.
      * @param weatherRecords The container to store the loaded data.
      * @param filename The path to the data file.
      * @return The number of records loaded, or -1 on error.
     */
     int LoadRecords(WeatherDatabase& weatherRecords, const string & filename);
+    /**
+     * @brief Loads weather records from a file and fills in its ingest statistics.
+     * Nothing is printed: rejected rows are counted in stats and errors kept in stats.messages,
+     * so files loaded on worker threads can be reported in list order.
+     * @param weatherRecords The container to store the loaded data.
+     * @param filename The path to the data file.
+     * @param stats Receives row counts, rejected rows per category, bytes and time.
+     * @return The number of records loaded, or -1 on error.
+     */
+    int LoadRecords(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats);
     /**
      * @brief Loads records from all filenames listed in the specified source file.
+     * The ingest report is printed on cerr once every file has been loaded.
      * @param weatherRecords The container to store ALL loaded data.
      * @param sourceFilename The file containing the list of CSV filenames (e.g., "data_source.txt").
      * @return The total number of records loaded from all files, or -1 on critical error.
      */
     int LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, const string& sourceFilename);
+    /**
+     * @brief Loads records from all listed files and returns the ingest report instead of printing it.
+     * @param weatherRecords The container to store ALL loaded data.
+     * @param sourceFilename The file containing the list of CSV filenames.
+     * @param report Receives one FileIngestStats per listed file, in list order.
+     * @return The total number of records loaded from all files, or -1 on critical error.
+     */
+    int LoadAllRecordsFromSourceFile(WeatherDatabase& weatherRecords, const string& sourceFilename,
+                                     IngestReport& report);
+    /**
+     * @brief Loads all records from the binary cache, or from the CSVs if the cache is stale.
+     * After a successful CSV load the cache is (re)written, so later startups only
+     * check file sizes/mtimes and map the cache instead of parsing text.
+     * @param weatherRecords The container to store ALL loaded data.
+     * @param sourceFilename The file containing the list of CSV filenames.
+     * @param cacheFilename The binary cache file (see RecordCache).
+     * @return The total number of records loaded, or -1 on critical error.
+     */
+    int LoadAllRecordsCached(WeatherDatabase& weatherRecords, const string& sourceFilename, const string& cacheFilename);
+    /**
+     * @brief Loads the schema's sensor columns of one CSV file into a SensorFrame.
+     * Columns outside the frame's schema are skipped without being converted.
+     * Errors are kept in stats.messages.
+     * LoadMode::Mapped tokenizes the rows in the mapped file; Stream and Pipelined read
+     * the file line by line (the rows are too cheap to be worth a parsing pipeline), as
+     * does Mapped for gzip-compressed files, which cannot be mapped.
+     * @param frame The frame to append rows to.
+     * @param filename The path to the data file.
+     * @param stats Receives row counts, rejected rows per category and bytes.
+     * @return The number of rows loaded, or -1 on error.
+     */
+    int LoadSensorColumns(SensorFrame& frame, const string& filename, FileIngestStats& stats);
+    /**
+     * @brief Loads the schema's sensor columns of every file listed in a source file.
+     * With more than one loader thread the files are loaded concurrently into
+     * per-file frames that are appended in list order.
+     * The ingest report is printed on cerr at the end.
+     * @param frame The frame to append rows to.
+     * @param sourceFilename The file containing the list of CSV filenames.
+     * @return The total number of rows loaded, or -1 if the list could not be read.
+     */
+    int LoadAllSensorColumnsFromSourceFile(SensorFrame& frame, const string& sourceFilename);
     /**
      * @brief Splits a string by a delimiter and returns the tokens in a Vector.
+     * Convenient for one-off strings; the loaders use CsvTokenizer instead, which
+     * returns views into the line and does not allocate per call.
      * @param s The string to split.
      * @param delimiter The character delimiter.
      * @return A Vector of strings (tokens).
      */
     Vector<string> splitString(const string& s, char delimiter);
+
+private:
+    LoadMode m_loadMode;       //!< File reading strategy used by LoadRecords.
+    int m_loaderThreads;       //!< Worker threads for LoadAllRecordsFromSourceFile.
+    int m_chunkThreads;        //!< Parser threads per file in the mapped and pipelined loaders.
+    bool m_skipUnfinishedLine; //!< Leave a final line without its '\n' for FileFollower.
+
+    /// @brief Reads the file line by line with ifstream/getline.
+    int loadRecordsStream(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats);
+
+    /// @brief Maps the file into memory and parses the rows in place.
+    int loadRecordsMapped(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats);
+
+    /// @brief Reads the sensor columns line by line through InputFile (plain or gzip).
+    int loadSensorColumnsStream(SensorFrame& frame, const string& filename, FileIngestStats& stats);
+
+    /// @brief Maps the file into memory and tokenizes the sensor columns in place.
+    int loadSensorColumnsMapped(SensorFrame& frame, const string& filename, FileIngestStats& stats);
+
+    /// @brief Reads, parses and inserts on separate threads joined by RingBuffers; in LoadMode::Pipelined the stage throughput is added to stats.messages.
+    int loadRecordsPipelined(WeatherDatabase& weatherRecords, const string& filename, FileIngestStats& stats);
+
+    /// @brief Loads each listed file into partials[i] on a pool of worker threads.
+    void loadFilesParallel(const Vector<string>& filenames, WeatherDatabase* partials, int* recordCounts,
+                           FileIngestStats* fileStats);
+
+    /// @brief Prints the per-file load result and updates the running totals.
+    bool tallyFileResult(const string& filename, int recordsFromFile, int& totalRecordsLoaded, int& filesProcessed);
 };
 
 #endif // CONTROLLER_H_INCLUDED
@@ -0,0 +1,330 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <zlib.h>
+#include "Controller.h"
+
+using namespace std;
+
+const string SOURCE_LIST = "data/data_source.txt";
+const string MIXED_LIST = "controller_test_source.txt";
+const string PLAIN_LIST = "controller_test_plain.txt";
+const string GZIP_LIST = "controller_test_gzip.txt";
+const string GZIP_FILE = "controller_test.csv.gz";
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+// Loads the source list with the given settings; the loader's console output goes to output
+// and the per-file statistics to report, which is not printed (it holds timings)
+static int loadWith(WeatherDatabase& database, const string& sourceList, LoadMode mode, int threads, int chunkThreads,
+                    string& output, IngestReport& report)
+{
+    Controller controller;
+    controller.SetLoadMode(mode);
+    controller.SetLoaderThreads(threads);
+    controller.SetChunkThreads(chunkThreads);
+
+    // cout and cerr share one buffer so the order of banners and errors is kept
+    ostringstream captured;
+    streambuf* oldOut = cout.rdbuf(captured.rdbuf());
+    streambuf* oldErr = cerr.rdbuf(captured.rdbuf());
+    int recordsLoaded = controller.LoadAllRecordsFromSourceFile(database, sourceList, report);
+    cout.rdbuf(oldOut);
+    cerr.rdbuf(oldErr);
+
+    output = captured.str();
+    return recordsLoaded;
+}
+
+// Writes a gzip copy of a file
+static bool gzipCopy(const string& from, const string& to)
+{
+    ifstream in(from, ios::binary);
+    stringstream contents;
+    contents << in.rdbuf();
+    string text = contents.str();
+    gzFile out = gzopen(to.c_str(), "wb");
+    if (!in.is_open() || out == nullptr)
+    {
+        return false;
+    }
+    gzwrite(out, text.data(), static_cast<unsigned>(text.size()));
+    return gzclose(out) == Z_OK;
+}
+
+// The WAST column has no seconds, so only the hour and minute of the time are compared
+static bool sameRecord(const WeatherRecord& a, const WeatherRecord& b)
+{
+    return a.GetDate().GetDay() == b.GetDate().GetDay() && a.GetDate().GetMonth() == b.GetDate().GetMonth()
+           && a.GetDate().GetYear() == b.GetDate().GetYear() && a.GetTime().GetHour() == b.GetTime().GetHour()
+           && a.GetTime().GetMinute() == b.GetTime().GetMinute()
+           && a.GetWindSpeed() == b.GetWindSpeed() && a.GetTemperature() == b.GetTemperature()
+           && a.GetSolarRadiation() == b.GetSolarRadiation();
+}
+
+// Compares every month of the years the data files can hold, row by row: days in order, then insertion order
+static bool sameMonths(const WeatherDatabase& a, const WeatherDatabase& b)
+{
+    if (a.GetRecordCount() != b.GetRecordCount())
+    {
+        return false;
+    }
+    for (int year = 1990; year <= 2030; ++year)
+    {
+        for (int month = 1; month <= 12; ++month)
+        {
+            const MonthColumns* monthA = a.GetMonthData(year, month);
+            const MonthColumns* monthB = b.GetMonthData(year, month);
+            if (monthA == nullptr || monthB == nullptr)
+            {
+                if (monthA != monthB)
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (monthA->getCount() != monthB->getCount())
+            {
+                return false;
+            }
+            for (int row = 0; row < monthA->getCount(); ++row)
+            {
+                if (!sameRecord(monthA->GetRecord(row), monthB->GetRecord(row)))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Same files with the same row counts, rejected rows and sample line numbers
+static bool sameReport(const IngestReport& a, const IngestReport& b)
+{
+    if (a.getCount() != b.getCount())
+    {
+        return false;
+    }
+    for (int i = 0; i < a.getCount(); ++i)
+    {
+        const FileIngestStats& fileA = a.GetFile(i);
+        const FileIngestStats& fileB = b.GetFile(i);
+        if (fileA.filename != fileB.filename || fileA.loaded != fileB.loaded || fileA.rowsAccepted != fileB.rowsAccepted
+                || fileA.bytes != fileB.bytes)
+        {
+            return false;
+        }
+        for (int s = 0; s < ROW_STATUS_COUNT; ++s)
+        {
+            if (fileA.issueCounts[s] != fileB.issueCounts[s])
+            {
+                return false;
+            }
+            long shown = (fileA.issueCounts[s] < MAX_SAMPLE_LINES) ? fileA.issueCounts[s] : MAX_SAMPLE_LINES;
+            for (long j = 0; j < shown; ++j)
+            {
+                if (fileA.sampleLines[s][j] != fileB.sampleLines[s][j])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Loads the listed sensor columns of the source list with the given settings
+static int loadSensorsWith(SensorFrame& frame, LoadMode mode, int threads)
+{
+    Controller controller;
+    controller.SetLoadMode(mode);
+    controller.SetLoaderThreads(threads);
+    return controller.LoadAllSensorColumnsFromSourceFile(frame, SOURCE_LIST);
+}
+
+static bool sameFrame(const SensorFrame& a, const SensorFrame& b)
+{
+    if (a.getCount() != b.getCount())
+    {
+        return false;
+    }
+    for (int row = 0; row < a.getCount(); ++row)
+    {
+        if (a.GetDate(row).GetDay() != b.GetDate(row).GetDay() || a.GetDate(row).GetMonth() != b.GetDate(row).GetMonth()
+                || a.GetDate(row).GetYear() != b.GetDate(row).GetYear() || a.GetTime(row).GetHour() != b.GetTime(row).GetHour()
+                || a.GetTime(row).GetMinute() != b.GetTime(row).GetMinute())
+        {
+            return false;
+        }
+        for (int slot = 0; slot < a.GetSchema().GetCount(); ++slot)
+        {
+            Sensor sensor = a.GetSchema().GetSensor(slot);
+            if (a.GetColumn(sensor)[row] != b.GetColumn(sensor)[row])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    cout << "--- Controller Unit Tests ---" << endl;
+
+    // The sequential stream loader is the reference for every other setting
+    WeatherDatabase reference;
+    string referenceOutput;
+    IngestReport referenceReport;
+    int referenceCount = loadWith(reference, SOURCE_LIST, LoadMode::Stream, 1, 1, referenceOutput, referenceReport);
+
+    // 1. Files parsed on worker threads and merged in list order
+    cout << "\n--- Stream Threads Test ---" << endl;
+    WeatherDatabase streamThreads;
+    string streamThreadsOutput;
+    IngestReport streamThreadsReport;
+    int streamThreadsCount = loadWith(streamThreads, SOURCE_LIST, LoadMode::Stream, 3, 1, streamThreadsOutput,
+                                      streamThreadsReport);
+    report("Stream Threads Test", referenceCount > 0 && streamThreadsCount == referenceCount
+           && sameMonths(streamThreads, reference) && streamThreadsOutput == referenceOutput
+           && sameReport(streamThreadsReport, referenceReport));
+
+    // 2. The mapped loader keeps the same records
+    cout << "\n--- Mapped Loader Test ---" << endl;
+    WeatherDatabase mapped;
+    string mappedOutput;
+    IngestReport mappedReport;
+    int mappedCount = loadWith(mapped, SOURCE_LIST, LoadMode::Mapped, 1, 1, mappedOutput, mappedReport);
+    report("Mapped Loader Test", mappedCount == referenceCount && sameMonths(mapped, reference)
+           && sameReport(mappedReport, referenceReport));
+
+    // 3. Mapped files on worker threads
+    cout << "\n--- Mapped Threads Test ---" << endl;
+    WeatherDatabase mappedThreads;
+    string mappedThreadsOutput;
+    IngestReport mappedThreadsReport;
+    int mappedThreadsCount = loadWith(mappedThreads, SOURCE_LIST, LoadMode::Mapped, 3, 1, mappedThreadsOutput,
+                                      mappedThreadsReport);
+    report("Mapped Threads Test", mappedThreadsCount == referenceCount && sameMonths(mappedThreads, reference)
+           && mappedThreadsOutput == mappedOutput && sameReport(mappedThreadsReport, referenceReport));
+
+    // 4. Large mapped files split into chunks parsed on their own threads
+    cout << "\n--- Mapped Chunks Test ---" << endl;
+    WeatherDatabase chunked;
+    string chunkedOutput;
+    IngestReport chunkedReport;
+    int chunkedCount = loadWith(chunked, SOURCE_LIST, LoadMode::Mapped, 1, 3, chunkedOutput, chunkedReport);
+    report("Mapped Chunks Test", chunkedCount == referenceCount && sameMonths(chunked, reference)
+           && chunkedOutput == mappedOutput && sameReport(chunkedReport, referenceReport));
+
+    // 5. Chunked files on top of per-file worker threads
+    cout << "\n--- Chunks And Threads Test ---" << endl;
+    WeatherDatabase chunkedThreads;
+    string chunkedThreadsOutput;
+    IngestReport chunkedThreadsReport;
+    int chunkedThreadsCount = loadWith(chunkedThreads, SOURCE_LIST, LoadMode::Mapped, 3, 2, chunkedThreadsOutput,
+                                       chunkedThreadsReport);
+    report("Chunks And Threads Test", chunkedThreadsCount == referenceCount && sameMonths(chunkedThreads, reference)
+           && chunkedThreadsOutput == mappedOutput && sameReport(chunkedThreadsReport, referenceReport));
+
+    // 6. The pipelined loader, alone and with per-file worker threads
+    cout << "\n--- Pipelined Loader Test ---" << endl;
+    WeatherDatabase pipelined;
+    WeatherDatabase pipelinedThreads;
+    string pipelinedOutput;
+    IngestReport pipelinedReport;
+    IngestReport pipelinedThreadsReport;
+    int pipelinedCount = loadWith(pipelined, SOURCE_LIST, LoadMode::Pipelined, 1, 2, pipelinedOutput, pipelinedReport);
+    int pipelinedThreadsCount = loadWith(pipelinedThreads, SOURCE_LIST, LoadMode::Pipelined, 3, 2, pipelinedOutput,
+                                         pipelinedThreadsReport);
+    report("Pipelined Loader Test", pipelinedCount == referenceCount && sameMonths(pipelined, reference)
+           && sameReport(pipelinedReport, referenceReport) && pipelinedThreadsCount == referenceCount
+           && sameMonths(pipelinedThreads, reference) && sameReport(pipelinedThreadsReport, referenceReport));
+
+    // 7. A missing file's error is printed after its own banner, whatever the thread count
+    cout << "\n--- Error Order Test ---" << endl;
+    {
+        ofstream list(MIXED_LIST);
+        list << "MetData-31-3.csv\nno_such_file.csv\nMetData-31-3a.csv\n";
+    }
+    WeatherDatabase sequentialMixed;
+    WeatherDatabase parallelMixed;
+    string sequentialOutput;
+    string parallelOutput;
+    IngestReport sequentialReport;
+    IngestReport parallelReport;
+    int sequentialCount = loadWith(sequentialMixed, MIXED_LIST, LoadMode::Stream, 1, 1, sequentialOutput,
+                                   sequentialReport);
+    int parallelCount = loadWith(parallelMixed, MIXED_LIST, LoadMode::Stream, 3, 1, parallelOutput, parallelReport);
+    remove(MIXED_LIST.c_str());
+    size_t banner = parallelOutput.find("Loading data from: no_such_file.csv");
+    size_t error = parallelOutput.find("Error: Could not open file data/no_such_file.csv");
+    report("Error Order Test", sequentialCount > 0 && parallelCount == sequentialCount
+           && parallelOutput == sequentialOutput && banner != string::npos && error != string::npos
+           && banner < error && sameMonths(parallelMixed, sequentialMixed) && sameReport(parallelReport, sequentialReport)
+           && parallelReport.getCount() == 3 && !parallelReport.GetFile(1).loaded);
+
+    // 8. Sensor columns load the same rows in list order with every loader setting
+    cout << "\n--- Sensor Columns Test ---" << endl;
+    SensorSchema schema;
+    SensorSchema::ParseList("S,T,RH,DP", schema);
+    SensorFrame sensorReference(schema);
+    SensorFrame sensorMapped(schema);
+    SensorFrame sensorThreads(schema);
+    SensorFrame sensorMappedThreads(schema);
+    int sensorRows = loadSensorsWith(sensorReference, LoadMode::Stream, 1);
+    report("Sensor Columns Test", sensorRows > 0
+           && loadSensorsWith(sensorMapped, LoadMode::Mapped, 1) == sensorRows && sameFrame(sensorMapped, sensorReference)
+           && loadSensorsWith(sensorThreads, LoadMode::Stream, 3) == sensorRows && sameFrame(sensorThreads, sensorReference)
+           && loadSensorsWith(sensorMappedThreads, LoadMode::Mapped, 3) == sensorRows
+           && sameFrame(sensorMappedThreads, sensorReference));
+
+    // 9. A gzip copy of a file loads the same records in every mode; stage stats only with Pipelined
+    cout << "\n--- Gzip Loader Test ---" << endl;
+    bool copied = gzipCopy("data/MetData-31-3.csv", "data/" + GZIP_FILE);
+    {
+        ofstream plainList(PLAIN_LIST);
+        plainList << "MetData-31-3.csv\n";
+        ofstream gzipList(GZIP_LIST);
+        gzipList << GZIP_FILE << "\n";
+    }
+    WeatherDatabase plain;
+    string plainOutput;
+    IngestReport plainReport;
+    int plainCount = loadWith(plain, PLAIN_LIST, LoadMode::Stream, 1, 1, plainOutput, plainReport);
+    bool gzipSame = copied && plainCount > 0;
+    const LoadMode modes[] = { LoadMode::Stream, LoadMode::Mapped, LoadMode::Pipelined };
+    for (LoadMode mode : modes)
+    {
+        WeatherDatabase gzipped;
+        string gzipOutput;
+        IngestReport gzipReport;
+        int gzipCount = loadWith(gzipped, GZIP_LIST, mode, 1, 2, gzipOutput, gzipReport);
+        bool statsPrinted = gzipOutput.find("Pipeline: inflate") != string::npos;
+        gzipSame = gzipSame && gzipCount == plainCount && sameMonths(gzipped, plain)
+                   && gzipReport.GetFile(0).bytes == plainReport.GetFile(0).bytes
+                   && statsPrinted == (mode == LoadMode::Pipelined);
+    }
+    Controller sensorController;
+    sensorController.SetLoadMode(LoadMode::Mapped);
+    SensorFrame plainSensors(schema);
+    SensorFrame gzipSensors(schema);
+    FileIngestStats plainSensorStats;
+    FileIngestStats gzipSensorStats;
+    int plainSensorRows = sensorController.LoadSensorColumns(plainSensors, "data/MetData-31-3.csv", plainSensorStats);
+    int gzipSensorRows = sensorController.LoadSensorColumns(gzipSensors, "data/" + GZIP_FILE, gzipSensorStats);
+    remove(PLAIN_LIST.c_str());
+    remove(GZIP_LIST.c_str());
+    remove(("data/" + GZIP_FILE).c_str());
+    report("Gzip Loader Test", gzipSame && plainSensorRows > 0 && gzipSensorRows == plainSensorRows
+           && sameFrame(gzipSensors, plainSensors));
+
+    cout << "\n--- End of Controller Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include "CsvScanner.h"
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CSVSCANNER_X86 1
+#include <immintrin.h>
+#endif
+
+// Scalar kernel: also finishes the tail that does not fill a vector register
+static size_t scanScalar(const char* data, size_t start, size_t length, char delimiter, uint32_t* positions, size_t count)
+{
+    for (size_t i = start; i < length; ++i)
+    {
+        if (data[i] == delimiter || data[i] == '\n')
+        {
+            positions[count++] = static_cast<uint32_t>(i);
+        }
+    }
+    return count;
+}
+
+#ifdef CSVSCANNER_X86
+
+// Appends the offset of every set bit of a match mask
+static inline size_t appendMask(uint32_t mask, size_t base, uint32_t* positions, size_t count)
+{
+    while (mask != 0)
+    {
+        positions[count++] = static_cast<uint32_t>(base + __builtin_ctz(mask));
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+__attribute__((target("sse2")))
+static size_t scanSse2(const char* data, size_t length, char delimiter, uint32_t* positions)
+{
+    const __m128i delimiters = _mm_set1_epi8(delimiter);
+    const __m128i newlines = _mm_set1_epi8('\n');
+    size_t count = 0;
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(bytes, delimiters), _mm_cmpeq_epi8(bytes, newlines));
+        count = appendMask(static_cast<uint32_t>(_mm_movemask_epi8(matches)), i, positions, count);
+    }
+
+    return scanScalar(data, i, length, delimiter, positions, count);
+}
+
+__attribute__((target("avx2")))
+static size_t scanAvx2(const char* data, size_t length, char delimiter, uint32_t* positions)
+{
+    const __m256i delimiters = _mm256_set1_epi8(delimiter);
+    const __m256i newlines = _mm256_set1_epi8('\n');
+    size_t count = 0;
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, delimiters), _mm256_cmpeq_epi8(bytes, newlines));
+        count = appendMask(static_cast<uint32_t>(_mm256_movemask_epi8(matches)), i, positions, count);
+    }
+
+    return scanScalar(data, i, length, delimiter, positions, count);
+}
+
+#endif // CSVSCANNER_X86
+
+ScanLevel CsvScanner::GetBestLevel()
+{
+#ifdef CSVSCANNER_X86
+    static const ScanLevel best = []()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return ScanLevel::Avx2;
+        }
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return ScanLevel::Sse2;
+        }
+        return ScanLevel::Scalar;
+    }();
+    return best;
+#else
+    return ScanLevel::Scalar;
+#endif
+}
+
+// Level used by Scan(); starts at the best level the first time it is read
+static std::atomic<int> g_activeLevel(-1);
+
+ScanLevel CsvScanner::GetLevel()
+{
+    int level = g_activeLevel.load(std::memory_order_relaxed);
+    if (level < 0)
+    {
+        return GetBestLevel();
+    }
+    return static_cast<ScanLevel>(level);
+}
+
+void CsvScanner::SetLevel(ScanLevel level)
+{
+    if (static_cast<int>(level) > static_cast<int>(GetBestLevel()))
+    {
+        level = GetBestLevel();
+    }
+    g_activeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+const char* CsvScanner::GetLevelName(ScanLevel level)
+{
+    switch (level)
+    {
+    case ScanLevel::Avx2:
+        return "avx2";
+    case ScanLevel::Sse2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
+
+size_t CsvScanner::Scan(const char* data, size_t length, char delimiter, uint32_t* positions)
+{
+    return ScanWith(GetLevel(), data, length, delimiter, positions);
+}
+
+size_t CsvScanner::ScanWith(ScanLevel level, const char* data, size_t length, char delimiter, uint32_t* positions)
+{
+#ifdef CSVSCANNER_X86
+    if (level == ScanLevel::Avx2)
+    {
+        return scanAvx2(data, length, delimiter, positions);
+    }
+    if (level == ScanLevel::Sse2)
+    {
+        return scanSse2(data, length, delimiter, positions);
+    }
+#else
+    (void)level;
+#endif
+    return scanScalar(data, 0, length, delimiter, positions, 0);
+}
+
+size_t StructuralIndex::Build(const char* data, size_t length, char delimiter)
+{
+    if (length > m_capacity)
+    {
+        delete[] m_positions;
+        m_positions = new uint32_t[length];
+        m_capacity = length;
+    }
+
+    m_count = CsvScanner::Scan(data, length, delimiter, m_positions);
+    return m_count;
+}
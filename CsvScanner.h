@@ -0,0 +1,123 @@
+#ifndef CSVSCANNER_H_INCLUDED
+#define CSVSCANNER_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum ScanLevel
+ * @brief Instruction set used to search a block for structural characters.
+ */
+enum class ScanLevel
+{
+    Scalar, //!< One byte at a time (portable fallback).
+    Sse2,   //!< 16 bytes per step.
+    Avx2    //!< 32 bytes per step.
+};
+
+/**
+ * @class CsvScanner
+ * @brief Finds every delimiter and newline in a block of CSV text.
+ *
+ * The vector kernels compare a whole register of bytes against the delimiter
+ * and '\n' at once and turn the matches into a bit mask, so the position list
+ * is built without testing each character individually. The best kernel the
+ * CPU supports is picked at run time; every kernel produces exactly the same
+ * positions as the scalar one.
+ */
+class CsvScanner
+{
+public:
+    /**
+     * @brief Gets the fastest scan level supported by this CPU.
+     * @return The detected ScanLevel (Scalar on non-x86 builds).
+     */
+    static ScanLevel GetBestLevel();
+
+    /**
+     * @brief Gets the scan level currently used by Scan().
+     * @return The active ScanLevel (defaults to GetBestLevel()).
+     */
+    static ScanLevel GetLevel();
+
+    /**
+     * @brief Selects the scan level used by Scan(), e.g. Scalar for comparisons.
+     * Requests above GetBestLevel() are lowered to GetBestLevel().
+     * @param level The requested ScanLevel.
+     */
+    static void SetLevel(ScanLevel level);
+
+    /**
+     * @brief Gets a printable name for a scan level.
+     * @param level The ScanLevel.
+     * @return "scalar", "sse2" or "avx2".
+     */
+    static const char* GetLevelName(ScanLevel level);
+
+    /**
+     * @brief Records the offset of every delimiter and '\n' in a block using the active level.
+     * @param data Start of the block.
+     * @param length Number of bytes in the block (must be below 4 GB).
+     * @param delimiter The field separator.
+     * @param positions Output array with room for at least length entries.
+     * @return The number of positions written, in ascending order.
+     */
+    static size_t Scan(const char* data, size_t length, char delimiter, uint32_t* positions);
+
+    /**
+     * @brief Same as Scan() but with an explicit level (must not exceed GetBestLevel()).
+     */
+    static size_t ScanWith(ScanLevel level, const char* data, size_t length, char delimiter, uint32_t* positions);
+};
+
+/**
+ * @class StructuralIndex
+ * @brief Re-usable buffer holding the structural positions of one block.
+ */
+class StructuralIndex
+{
+public:
+    StructuralIndex() : m_positions(nullptr), m_capacity(0), m_count(0) {}
+
+    ~StructuralIndex()
+    {
+        delete[] m_positions;
+    }
+
+    /**
+     * @brief Scans a block and stores the delimiter/newline offsets.
+     * The buffer only grows when a block is larger than any seen before.
+     * @param data Start of the block.
+     * @param length Number of bytes in the block.
+     * @param delimiter The field separator.
+     * @return The number of structural characters found.
+     */
+    size_t Build(const char* data, size_t length, char delimiter);
+
+    /**
+     * @brief Gets the number of positions from the last Build().
+     */
+    size_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Gets the offsets (relative to the block start) from the last Build().
+     */
+    const uint32_t* GetPositions() const
+    {
+        return m_positions;
+    }
+
+private:
+    // The position table is a raw buffer, so copying is disabled.
+    StructuralIndex(const StructuralIndex&) = delete;
+    StructuralIndex& operator=(const StructuralIndex&) = delete;
+
+    uint32_t* m_positions; //!< Offsets of structural characters.
+    size_t m_capacity;     //!< Allocated size of m_positions.
+    size_t m_count;        //!< Positions found by the last Build().
+};
+
+#endif // CSVSCANNER_H_INCLUDED
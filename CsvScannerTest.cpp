@@ -0,0 +1,112 @@
+#include <iostream>
+#include <string>
+#include "CsvScanner.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+// Compares the positions found by a vector kernel against the scalar kernel
+static bool sameAsScalar(ScanLevel level, const char* data, size_t length)
+{
+    uint32_t* expected = new uint32_t[length + 1];
+    uint32_t* actual = new uint32_t[length + 1];
+
+    size_t expectedCount = CsvScanner::ScanWith(ScanLevel::Scalar, data, length, ',', expected);
+    size_t actualCount = CsvScanner::ScanWith(level, data, length, ',', actual);
+
+    bool same = (expectedCount == actualCount);
+    for (size_t i = 0; same && i < expectedCount; ++i)
+    {
+        same = (expected[i] == actual[i]);
+    }
+
+    delete[] expected;
+    delete[] actual;
+    return same;
+}
+
+int main()
+{
+    cout << "--- CsvScanner Unit Tests ---" << endl;
+
+    ScanLevel best = CsvScanner::GetBestLevel();
+    cout << "Best scan level on this CPU: " << CsvScanner::GetLevelName(best) << endl;
+
+    // 1. Scalar Positions Test
+    cout << "\n--- Scalar Positions Test ---" << endl;
+    const string line = "a,bc,,d\ne,f";
+    uint32_t positions[16];
+    size_t count = CsvScanner::ScanWith(ScanLevel::Scalar, line.data(), line.size(), ',', positions);
+    cout << "Positions found: " << count << endl; // Should be 1 4 5 7 9
+    if (count == 5 && positions[0] == 1 && positions[1] == 4 && positions[2] == 5
+            && positions[3] == 7 && positions[4] == 9)
+    {
+        cout << "Scalar Positions Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Scalar Positions Test: FAILED" << endl;
+    }
+
+    // 2. Block Tail Test (lengths that do not fill a vector register)
+    cout << "\n--- Block Tail Test ---" << endl;
+    const string text = "1/01/2007 9:00,15.5,200,26,44.27,1007,1010.4\n1/01/2007 9:10,15.7,,30,\n,";
+    bool tailsMatch = true;
+    for (size_t length = 0; length <= text.size(); ++length)
+    {
+        for (int level = static_cast<int>(ScanLevel::Sse2); level <= static_cast<int>(best); ++level)
+        {
+            tailsMatch = tailsMatch && sameAsScalar(static_cast<ScanLevel>(level), text.data(), length);
+        }
+    }
+    if (tailsMatch)
+    {
+        cout << "Block Tail Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Block Tail Test: FAILED" << endl;
+    }
+
+    // 3. Data File Test (every kernel must match the scalar index on the real files)
+    cout << "\n--- Data File Test ---" << endl;
+    const string files[] =
+    {
+        "data/MetData-31-3.csv", "data/MetData-31-3a.csv", "data/MetData-31-3b.csv",
+        "data/MetData-31-3c.csv", "data/Metdata-Jan-Dec2007.csv"
+    };
+    for (const string& filename : files)
+    {
+        MappedFile file;
+        if (!file.Open(filename))
+        {
+            cout << filename << ": could not open, SKIPPED" << endl;
+            continue;
+        }
+
+        bool filesMatch = true;
+        for (int level = static_cast<int>(ScanLevel::Sse2); level <= static_cast<int>(best); ++level)
+        {
+            filesMatch = filesMatch && sameAsScalar(static_cast<ScanLevel>(level), file.GetData(), file.GetSize());
+        }
+        cout << filename << ": " << (filesMatch ? "PASSED" : "FAILED") << endl;
+    }
+
+    // 4. SetLevel Test (requests above the CPU's level are lowered)
+    cout << "\n--- SetLevel Test ---" << endl;
+    CsvScanner::SetLevel(ScanLevel::Avx2);
+    ScanLevel clamped = CsvScanner::GetLevel();
+    CsvScanner::SetLevel(ScanLevel::Scalar);
+    if (clamped == best && CsvScanner::GetLevel() == ScanLevel::Scalar)
+    {
+        cout << "SetLevel Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "SetLevel Test: FAILED" << endl;
+    }
+
+    cout << "\n--- End of CsvScanner Unit Tests ---" << endl;
+
+    return 0;
+}
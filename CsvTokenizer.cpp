@@ -0,0 +1,98 @@
+#include "CsvTokenizer.h"
+
+CsvTokenizer::CsvTokenizer(char delimiter)
+    : m_delimiter(delimiter),
+      m_fields(new string_view[TOKENIZER_INITIAL_FIELDS]),
+      m_capacity(TOKENIZER_INITIAL_FIELDS),
+      m_count(0)
+{
+}
+
+CsvTokenizer::~CsvTokenizer()
+{
+    delete[] m_fields;
+    m_fields = nullptr;
+}
+
+void CsvTokenizer::grow()
+{
+    int newCapacity = m_capacity * 2;
+    string_view* newFields = new string_view[newCapacity];
+
+    for (int i = 0; i < m_count; ++i)
+    {
+        newFields[i] = m_fields[i];
+    }
+
+    delete[] m_fields;
+    m_fields = newFields;
+    m_capacity = newCapacity;
+}
+
+int CsvTokenizer::Tokenize(string_view line)
+{
+    m_count = 0;
+    if (line.empty())
+    {
+        return 0;
+    }
+
+    const char* data = line.data();
+    size_t length = line.size();
+    size_t fieldStart = 0;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (data[i] == m_delimiter)
+        {
+            if (m_count == m_capacity)
+            {
+                grow();
+            }
+            m_fields[m_count++] = string_view(data + fieldStart, i - fieldStart);
+            fieldStart = i + 1;
+        }
+    }
+
+    // The last field, unless the line ended with a delimiter
+    if (fieldStart < length)
+    {
+        if (m_count == m_capacity)
+        {
+            grow();
+        }
+        m_fields[m_count++] = string_view(data + fieldStart, length - fieldStart);
+    }
+
+    return m_count;
+}
+
+int CsvTokenizer::TokenizeIndexed(const char* base, uint32_t lineStart, uint32_t lineEnd,
+                                  const uint32_t* delimiters, int delimiterCount)
+{
+    m_count = 0;
+    if (lineStart == lineEnd)
+    {
+        return 0;
+    }
+
+    while (m_capacity < delimiterCount + 1)
+    {
+        grow();
+    }
+
+    uint32_t fieldStart = lineStart;
+    for (int i = 0; i < delimiterCount; ++i)
+    {
+        m_fields[m_count++] = string_view(base + fieldStart, delimiters[i] - fieldStart);
+        fieldStart = delimiters[i] + 1;
+    }
+
+    // The last field, unless the line ended with a delimiter
+    if (fieldStart < lineEnd)
+    {
+        m_fields[m_count++] = string_view(base + fieldStart, lineEnd - fieldStart);
+    }
+
+    return m_count;
+}
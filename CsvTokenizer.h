@@ -0,0 +1,92 @@
+#ifndef CSVTOKENIZER_H_INCLUDED
+#define CSVTOKENIZER_H_INCLUDED
+
+#include <string_view>
+#include <cstdint>
+
+using std::string_view;
+
+// Fields the table holds before its first grow(); the data files have 18 columns
+const int TOKENIZER_INITIAL_FIELDS = 20;
+
+/**
+ * @class CsvTokenizer
+ * @brief Splits a line into fields without copying or allocating per line.
+ *
+ * Fields are returned as string_views pointing into the caller's line, so they
+ * are only valid while that line is alive and until the next call to Tokenize().
+ * The field table is owned by the tokenizer and re-used for every line; it only
+ * grows when a line has more fields than any line seen before. Keep one
+ * tokenizer per thread (it is not safe to share between threads).
+ *
+ * Token rules match Controller::splitString: an empty line has no fields and a
+ * trailing delimiter does not start an extra empty field.
+ */
+class CsvTokenizer
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param delimiter The field separator character.
+     */
+    explicit CsvTokenizer(char delimiter);
+
+    /**
+     * @brief Destructor. Releases the field table.
+     */
+    ~CsvTokenizer();
+
+    /**
+     * @brief Splits a line into fields.
+     * @param line The line to split (without its trailing newline).
+     * @return The number of fields found.
+     */
+    int Tokenize(string_view line);
+
+    /**
+     * @brief Builds the fields of a line from pre-computed delimiter positions.
+     * Used with a StructuralIndex so the line's characters are not scanned again.
+     * @param base Start of the block the offsets are relative to.
+     * @param lineStart Offset of the first character of the line.
+     * @param lineEnd Offset one past the last character (the '\n' or end of block).
+     * @param delimiters Offsets of the delimiters inside the line, ascending.
+     * @param delimiterCount Number of entries in delimiters.
+     * @return The number of fields found (same rules as Tokenize()).
+     */
+    int TokenizeIndexed(const char* base, uint32_t lineStart, uint32_t lineEnd,
+                        const uint32_t* delimiters, int delimiterCount);
+
+    /**
+     * @brief Gets the number of fields from the last Tokenize() call.
+     * @return The field count.
+     */
+    int getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Access operator for a field of the last tokenized line.
+     * @param index The field index (0 to getCount() - 1). Not range checked.
+     * @return A view of the field's characters.
+     */
+    string_view operator[](int index) const
+    {
+        return m_fields[index];
+    }
+
+private:
+    // The field table is a raw buffer, so copying is disabled.
+    CsvTokenizer(const CsvTokenizer&) = delete;
+    CsvTokenizer& operator=(const CsvTokenizer&) = delete;
+
+    /// @brief Doubles the capacity of the field table.
+    void grow();
+
+    char m_delimiter;      //!< Field separator.
+    string_view* m_fields; //!< Re-used table of field views.
+    int m_capacity;        //!< Allocated size of m_fields.
+    int m_count;           //!< Fields found in the last line.
+};
+
+#endif // CSVTOKENIZER_H_INCLUDED
@@ -0,0 +1,41 @@
+#include "DuplicateIndex.h"
+
+DuplicateIndex& DuplicateIndex::operator=(const DuplicateIndex& other)
+{
+    if (this != &other)
+    {
+        m_days = other.m_days;
+        m_lastKey = -1;
+        m_lastDay = nullptr;
+    }
+    return *this;
+}
+
+bool DuplicateIndex::TestAndSet(const Date& date, const Time& time)
+{
+    int slot = time.GetHour() * 60 + time.GetMinute();
+    if (time.GetHour() < 0 || time.GetMinute() < 0 || time.GetMinute() > 59 || slot >= MINUTES_PER_DAY)
+    {
+        return false;
+    }
+
+    int key = (date.GetYear() * 100 + date.GetMonth()) * 100 + date.GetDay();
+    if (key != m_lastKey || m_lastDay == nullptr)
+    {
+        m_lastDay = &m_days[key];
+        m_lastKey = key;
+    }
+
+    uint64_t mask = uint64_t(1) << (slot & 63);
+    uint64_t& word = m_lastDay->bits[slot >> 6];
+    bool taken = (word & mask) != 0;
+    word |= mask;
+    return taken;
+}
+
+void DuplicateIndex::Clear()
+{
+    m_days.clear();
+    m_lastKey = -1;
+    m_lastDay = nullptr;
+}
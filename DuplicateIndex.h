@@ -0,0 +1,70 @@
+#ifndef DUPLICATEINDEX_H_INCLUDED
+#define DUPLICATEINDEX_H_INCLUDED
+
+#include "Date.h"
+#include "Time.h"
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @enum DuplicatePolicy
+ * @brief What WeatherDatabase::Insert does with a row whose timestamp is already stored.
+ */
+enum class DuplicatePolicy
+{
+    KeepAll,   //!< No duplicate check (original behaviour).
+    FirstWins, //!< Keep the record loaded first and drop later copies.
+    LastWins,  //!< Replace the stored record with the later copy.
+    Flag       //!< Keep every copy but count the duplicates.
+};
+
+/// @brief Minute slots in one day.
+const int MINUTES_PER_DAY = 24 * 60;
+
+/**
+ * @class DuplicateIndex
+ * @brief Set of loaded timestamps at one-minute resolution.
+ *
+ * Each day that has data owns a 1440-bit bitmap (180 bytes), one bit per
+ * minute, held in a hash map keyed on the date. Checking a row is one hash
+ * lookup and one bit test; rows usually arrive in time order, so the last
+ * day used is remembered and the lookup is skipped for the rest of that day.
+ */
+class DuplicateIndex
+{
+public:
+    DuplicateIndex() : m_days(), m_lastKey(-1), m_lastDay(nullptr) {}
+
+    DuplicateIndex(const DuplicateIndex& other) : m_days(other.m_days), m_lastKey(-1), m_lastDay(nullptr) {}
+
+    DuplicateIndex& operator=(const DuplicateIndex& other);
+
+    /**
+     * @brief Marks a timestamp as loaded.
+     * Timestamps outside 00:00-23:59 are never reported as duplicates.
+     * @param date The record date.
+     * @param time The record time; the seconds are ignored.
+     * @return true if the minute was already marked.
+     */
+    bool TestAndSet(const Date& date, const Time& time);
+
+    /**
+     * @brief Forgets every timestamp.
+     */
+    void Clear();
+
+private:
+    /**
+     * @brief Bitmap of the minutes of one day that hold a record.
+     */
+    struct DaySlots
+    {
+        uint64_t bits[(MINUTES_PER_DAY + 63) / 64] = {};
+    };
+
+    std::unordered_map<int, DaySlots> m_days; //!< Bitmaps keyed by year * 10000 + month * 100 + day.
+    int m_lastKey;                            //!< Key of m_lastDay, or -1.
+    DaySlots* m_lastDay;                      //!< Most recently used bitmap (map nodes do not move).
+};
+
+#endif // DUPLICATEINDEX_H_INCLUDED
@@ -0,0 +1,132 @@
+#include <iostream>
+#include <string>
+#include "DuplicateIndex.h"
+#include "WeatherDatabase.h"
+
+using namespace std;
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static WeatherRecord makeRecord(int day, int month, int year, int hour, int minute, int second, float speed)
+{
+    WeatherRecord record;
+    record.SetDate(Date(day, month, year));
+    record.SetTime(Time(hour, minute, second));
+    record.SetWindSpeed(speed);
+    record.SetTemperature(speed + 20.0f);
+    record.SetSolarRadiation(speed * 100.0f);
+    return record;
+}
+
+// Loads the same three rows under a policy: the middle one repeats the first one's minute
+static void loadCopies(WeatherDatabase& database, DuplicatePolicy policy)
+{
+    database.SetDuplicatePolicy(policy);
+    database.Insert(makeRecord(5, 3, 2010, 9, 0, 0, 1.0f));
+    database.Insert(makeRecord(5, 3, 2010, 9, 0, 30, 2.0f));
+    database.Insert(makeRecord(5, 3, 2010, 9, 10, 0, 3.0f));
+}
+
+// The records stored for 5 March 2010, in row order (empty if that day has none)
+static Vector<WeatherRecord> storedDay(const WeatherDatabase& database)
+{
+    Vector<WeatherRecord> day;
+    const MonthColumns* month = database.GetMonthData(2010, 3);
+    if (month != nullptr)
+    {
+        for (int row = month->GetDayBegin(5); row < month->GetDayEnd(5); ++row)
+        {
+            day.PushBack(month->GetRecord(row));
+        }
+    }
+    return day;
+}
+
+int main()
+{
+    cout << "--- DuplicateIndex Unit Tests ---" << endl;
+
+    // 1. A minute is reported once it has been marked; the seconds are ignored
+    cout << "\n--- Test And Set Test ---" << endl;
+    DuplicateIndex index;
+    bool firstSeen = !index.TestAndSet(Date(5, 3, 2010), Time(9, 0, 0));
+    bool repeated = index.TestAndSet(Date(5, 3, 2010), Time(9, 0, 59));
+    bool nextMinute = !index.TestAndSet(Date(5, 3, 2010), Time(9, 1, 0));
+    bool lastMinute = !index.TestAndSet(Date(5, 3, 2010), Time(23, 59, 0))
+                      && index.TestAndSet(Date(5, 3, 2010), Time(23, 59, 0));
+    report("Test And Set Test", firstSeen && repeated && nextMinute && lastMinute);
+
+    // 2. The same minute on another day, month or year is a different key
+    cout << "\n--- Cross Day Key Test ---" << endl;
+    bool otherDay = !index.TestAndSet(Date(6, 3, 2010), Time(9, 0, 0));
+    bool otherMonth = !index.TestAndSet(Date(5, 4, 2010), Time(9, 0, 0));
+    bool otherYear = !index.TestAndSet(Date(5, 3, 2011), Time(9, 0, 0));
+    bool backToFirst = index.TestAndSet(Date(5, 3, 2010), Time(9, 0, 0))
+                       && index.TestAndSet(Date(6, 3, 2010), Time(9, 0, 0));
+    report("Cross Day Key Test", otherDay && otherMonth && otherYear && backToFirst);
+
+    // 3. Times outside 00:00-23:59 are never duplicates
+    cout << "\n--- Out Of Range Time Test ---" << endl;
+    bool outOfRange = true;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        outOfRange = outOfRange && !index.TestAndSet(Date(5, 3, 2010), Time(25, 0, 0))
+                     && !index.TestAndSet(Date(5, 3, 2010), Time(9, 70, 0))
+                     && !index.TestAndSet(Date(5, 3, 2010), Time(-1, 0, 0))
+                     && !index.TestAndSet(Date(5, 3, 2010), Time(9, -5, 0));
+    }
+    report("Out Of Range Time Test", outOfRange);
+
+    // 4. Copies keep the marks; Clear forgets them
+    cout << "\n--- Copy And Clear Test ---" << endl;
+    DuplicateIndex copy(index);
+    DuplicateIndex assigned;
+    assigned = index;
+    index.Clear();
+    bool copied = copy.TestAndSet(Date(5, 3, 2010), Time(9, 0, 0))
+                  && assigned.TestAndSet(Date(6, 3, 2010), Time(9, 0, 0));
+    bool cleared = !index.TestAndSet(Date(5, 3, 2010), Time(9, 0, 0))
+                   && !index.TestAndSet(Date(6, 3, 2010), Time(9, 0, 0));
+    report("Copy And Clear Test", copied && cleared);
+
+    // 5. FirstWins drops the later copy and keeps the first values
+    cout << "\n--- First Wins Test ---" << endl;
+    WeatherDatabase firstWins;
+    loadCopies(firstWins, DuplicatePolicy::FirstWins);
+    Vector<WeatherRecord> firstDay = storedDay(firstWins);
+    report("First Wins Test", firstDay.getCount() == 2 && firstWins.GetRecordCount() == 2
+           && firstWins.GetDuplicateCount() == 1 && firstDay[0].GetWindSpeed() == 1.0f
+           && firstDay[1].GetWindSpeed() == 3.0f);
+
+    // 6. LastWins replaces the stored row in place, so the day keeps one row per minute
+    cout << "\n--- Last Wins Test ---" << endl;
+    WeatherDatabase lastWins;
+    loadCopies(lastWins, DuplicatePolicy::LastWins);
+    Vector<WeatherRecord> lastDay = storedDay(lastWins);
+    report("Last Wins Test", lastDay.getCount() == 2 && lastWins.GetRecordCount() == 2
+           && lastWins.GetDuplicateCount() == 1 && lastDay[0].GetWindSpeed() == 2.0f
+           && lastDay[0].GetSolarRadiation() == 200.0f && lastDay[0].GetTime().GetSecond() == 30
+           && lastDay[1].GetWindSpeed() == 3.0f);
+
+    // 7. Flag keeps every copy in arrival order and counts the repeats
+    cout << "\n--- Flag Test ---" << endl;
+    WeatherDatabase flagged;
+    loadCopies(flagged, DuplicatePolicy::Flag);
+    flagged.Insert(makeRecord(5, 3, 2010, 9, 0, 0, 4.0f));
+    Vector<WeatherRecord> flaggedDay = storedDay(flagged);
+    report("Flag Test", flaggedDay.getCount() == 4 && flagged.GetRecordCount() == 4
+           && flagged.GetDuplicateCount() == 2 && flaggedDay[1].GetWindSpeed() == 2.0f
+           && flaggedDay[3].GetWindSpeed() == 4.0f);
+
+    // 8. KeepAll does no check at all
+    cout << "\n--- Keep All Test ---" << endl;
+    WeatherDatabase keepAll;
+    loadCopies(keepAll, DuplicatePolicy::KeepAll);
+    report("Keep All Test", keepAll.GetRecordCount() == 3 && keepAll.GetDuplicateCount() == 0);
+
+    cout << "\n--- End of DuplicateIndex Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,500 @@
+#ifndef EYTZINGERSET_H_INCLUDED
+#define EYTZINGERSET_H_INCLUDED
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Bst.h"
+
+/**
+ * @class EytzingerSet
+ * @brief Ordered set kept in contiguous arrays, with a cache-friendly branchless search.
+ *
+ * The items live in one array sorted by key, so iteration and key ranges are a
+ * linear scan. Lookups do not touch the items: they search a copy of the keys
+ * stored in Eytzinger (breadth-first) order, where the children of slot k are
+ * slots 2k and 2k + 1. The top levels of the implicit tree share a few cache
+ * lines, each step is a compare and a shift with no unpredictable branch, and
+ * the next levels are prefetched while the current one is compared.
+ *
+ * The interface follows Bst so the two can be swapped at compile time, with one
+ * difference: inserting or deleting a key shifts the items and rebuilds the
+ * index in O(n), which invalidates pointers and iterators to items. It suits key
+ * sets that are built in bulk (BuildFromSorted) or that gain few new keys
+ * compared with how often they are searched, such as the years and months of a
+ * WeatherDatabase.
+ *
+ * @tparam T The item type. Items are ordered by BstKey<T>::Get(item) using operator< only.
+ * @tparam Alloc Standard-library style allocator for the item, key and rank arrays.
+ */
+template <class T, class Alloc = std::allocator<T>>
+class EytzingerSet
+{
+public:
+    /// @brief The type items are ordered and looked up by.
+    typedef typename BstKey<T>::KeyType Key;
+
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef BstRange<iterator> Range;
+    typedef BstRange<const_iterator> ConstRange;
+
+    /**
+     * @brief Default constructor. Creates an empty set.
+     */
+    EytzingerSet() : m_items(), m_keys(1), m_ranks(1) {}
+
+    /**
+     * @brief Constructor for an empty set whose arrays come from the given allocator.
+     * @param allocator The allocator.
+     */
+    explicit EytzingerSet(const Alloc& allocator)
+        : m_items(allocator), m_keys(1, Key(), KeyAlloc(allocator)), m_ranks(1, 0, RankAlloc(allocator)) {}
+
+    /**
+     * @brief Checks if the set is empty.
+     * @return true if it holds no items.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes every item.
+     */
+    void DestroyTree();
+
+    /**
+     * @brief Calls 'visit_func' on each item in key order.
+     * @param visit_func The function pointer to call for each item.
+     * @param userData A void pointer to pass 'context' (e.g., a collector object).
+     */
+    void InOrder(visit_t<T> visit_func, void* userData);
+
+    /**
+     * @brief Calls visit(item) on each item in key order; returning false from a bool visitor stops early.
+     * @param visit The callable, taking T& (const T& on a const set).
+     * @return false if the visitor stopped the traversal early, true otherwise.
+     */
+    template <class Visitor>
+    bool InOrder(Visitor&& visit);
+    template <class Visitor>
+    bool InOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Gets an iterator to the smallest item. Items must not be modified in a way that changes their key.
+     * @return The iterator; equal to end() for an empty set.
+     */
+    iterator begin();
+    const_iterator begin() const;
+
+    /**
+     * @brief Gets the past-the-end iterator.
+     * @return The iterator.
+     */
+    iterator end();
+    const_iterator end() const;
+
+    /**
+     * @brief Finds the first item whose key is not less than key.
+     * @param key The key to look for.
+     * @return The iterator, or end() if every key is less.
+     */
+    iterator LowerBound(const Key& key);
+    const_iterator LowerBound(const Key& key) const;
+
+    /**
+     * @brief Finds the first item whose key is greater than key.
+     * @param key The key to look for.
+     * @return The iterator, or end() if no key is greater.
+     */
+    iterator UpperBound(const Key& key);
+    const_iterator UpperBound(const Key& key) const;
+
+    /**
+     * @brief Gets the items with keys from first to last inclusive.
+     * @param first The smallest key wanted.
+     * @param last The largest key wanted.
+     * @return The range (empty if last < first).
+     */
+    Range GetRange(const Key& first, const Key& last);
+    ConstRange GetRange(const Key& first, const Key& last) const;
+
+    /**
+     * @brief Inserts a copy of data unless its key is already present.
+     * @param data The element to be inserted.
+     */
+    void Insert(const T& data);
+
+    /**
+     * @brief Inserts data, moving it in, unless its key is already present.
+     * @param data The element to be inserted.
+     */
+    void Insert(T&& data);
+
+    /**
+     * @brief Searches for the item with the same key as data.
+     * @param data The element to search for (used for comparison).
+     * @return A pointer to the item, or nullptr if not found.
+     */
+    T* Search(const T& data);
+    const T* Search(const T& data) const;
+
+    /**
+     * @brief Searches for the item with the given key.
+     * @param key The key to look for.
+     * @return A pointer to the item, or nullptr if not found.
+     */
+    T* Find(const Key& key);
+    const T* Find(const Key& key) const;
+
+    /**
+     * @brief Finds the item with the given key, constructing it in place if it is missing.
+     * @param key The key to look for.
+     * @param args Constructor arguments for the new item; it must have the given key.
+     * @return A pointer to the found or new item (valid until the next insert or delete).
+     */
+    template <class... Args>
+    T* FindOrInsert(const Key& key, Args&&... args);
+
+    /**
+     * @brief Deletes the item with the same key as deleteTarget, if present.
+     * @param deleteTarget The value of the item to be deleted.
+     */
+    void DeleteNode(const T& deleteTarget);
+
+    /**
+     * @brief Replaces the contents with the items of a sorted range in O(n).
+     * @param first Start of the range; the items must be sorted by key with no repeated keys.
+     * @param last End of the range.
+     * @return false (leaving the set empty) if the range is not strictly increasing.
+     */
+    template <class ForwardIt>
+    bool BuildFromSorted(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief Does nothing: the index is rebuilt on every change, so it is always balanced.
+     * Provided so code written against Bst compiles unchanged.
+     */
+    void Rebalance();
+
+    /**
+     * @brief Gets the height of the implicit search tree (levels a lookup may visit).
+     * @return The height; 0 for an empty set.
+     */
+    int GetHeight() const;
+
+private:
+    typedef std::allocator_traits<Alloc> AllocTraits;
+    typedef typename AllocTraits::template rebind_alloc<Key> KeyAlloc;
+    typedef typename AllocTraits::template rebind_alloc<int> RankAlloc;
+
+    std::vector<T, Alloc> m_items;          //!< The items, sorted by key.
+    std::vector<Key, KeyAlloc> m_keys;      //!< Keys in Eytzinger order; slot 0 is unused.
+    std::vector<int, RankAlloc> m_ranks;    //!< Position in m_items of the key in each slot.
+
+    /// @brief Gets the number of items.
+    size_t count() const;
+
+    /// @brief Rebuilds the Eytzinger key and rank arrays from m_items.
+    void rebuildIndex();
+
+    /// @brief Fills slot k and its subtree in order, taking ranks from next onwards; returns the next rank.
+    size_t fillSlot(size_t k, size_t next);
+
+    /// @brief Branchless descent: the position in m_items of the first key not less (Upper: greater) than key.
+    template <bool Upper>
+    size_t boundRank(const Key& key) const;
+};
+
+template <class T, class Alloc>
+size_t EytzingerSet<T, Alloc>::count() const
+{
+    return m_items.size();
+}
+
+template <class T, class Alloc>
+bool EytzingerSet<T, Alloc>::isEmpty() const
+{
+    return m_items.empty();
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::DestroyTree()
+{
+    m_items.clear();
+    rebuildIndex();
+}
+
+// --- Index ---
+template <class T, class Alloc>
+size_t EytzingerSet<T, Alloc>::fillSlot(size_t k, size_t next)
+{
+    if (k <= count())
+    {
+        next = fillSlot(2 * k, next);
+        m_keys[k] = BstKey<T>::Get(m_items[next]);
+        m_ranks[k] = static_cast<int>(next);
+        next = fillSlot(2 * k + 1, next + 1);
+    }
+    return next;
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::rebuildIndex()
+{
+    m_keys.resize(count() + 1);
+    m_ranks.resize(count() + 1);
+    fillSlot(1, 0);
+}
+
+template <class T, class Alloc>
+template <bool Upper>
+size_t EytzingerSet<T, Alloc>::boundRank(const Key& key) const
+{
+    const Key* keys = m_keys.data();
+    size_t n = count();
+    size_t k = 1;
+    while (k <= n)
+    {
+#if defined(__GNUC__)
+        // Four levels down, the 16 descendants of slot k are contiguous
+        __builtin_prefetch(keys + 16 * k);
+#endif
+        // Go right while the slot's key is still before the bound; the comparison is not a branch
+        bool right = Upper ? !(key < keys[k]) : (keys[k] < key);
+        k = 2 * k + static_cast<size_t>(right);
+    }
+
+    // Undo the trailing right turns and the last left turn: k is then the last slot we turned left at
+#if defined(__GNUC__)
+    k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+#else
+    while (k & 1)
+    {
+        k >>= 1;
+    }
+    k >>= 1;
+#endif
+    return (k == 0) ? n : static_cast<size_t>(m_ranks[k]);
+}
+
+// --- Iteration ---
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::iterator EytzingerSet<T, Alloc>::begin()
+{
+    return m_items.data();
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::const_iterator EytzingerSet<T, Alloc>::begin() const
+{
+    return m_items.data();
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::iterator EytzingerSet<T, Alloc>::end()
+{
+    return m_items.data() + count();
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::const_iterator EytzingerSet<T, Alloc>::end() const
+{
+    return m_items.data() + count();
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::iterator EytzingerSet<T, Alloc>::LowerBound(const Key& key)
+{
+    return begin() + boundRank<false>(key);
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::const_iterator EytzingerSet<T, Alloc>::LowerBound(const Key& key) const
+{
+    return begin() + boundRank<false>(key);
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::iterator EytzingerSet<T, Alloc>::UpperBound(const Key& key)
+{
+    return begin() + boundRank<true>(key);
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::const_iterator EytzingerSet<T, Alloc>::UpperBound(const Key& key) const
+{
+    return begin() + boundRank<true>(key);
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::Range EytzingerSet<T, Alloc>::GetRange(const Key& first, const Key& last)
+{
+    if (last < first)
+    {
+        return Range(end(), end());
+    }
+    return Range(LowerBound(first), UpperBound(last));
+}
+
+template <class T, class Alloc>
+typename EytzingerSet<T, Alloc>::ConstRange EytzingerSet<T, Alloc>::GetRange(const Key& first, const Key& last) const
+{
+    if (last < first)
+    {
+        return ConstRange(end(), end());
+    }
+    return ConstRange(LowerBound(first), UpperBound(last));
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::InOrder(visit_t<T> visit_func, void* userData)
+{
+    for (size_t i = 0; i < count(); ++i)
+    {
+        visit_func(m_items[i], userData);
+    }
+}
+
+template <class T, class Alloc>
+template <class Visitor>
+bool EytzingerSet<T, Alloc>::InOrder(Visitor&& visit)
+{
+    for (size_t i = 0; i < count(); ++i)
+    {
+        if constexpr (std::is_void<decltype(visit(m_items[i]))>::value)
+        {
+            visit(m_items[i]);
+        }
+        else if (!visit(m_items[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class T, class Alloc>
+template <class Visitor>
+bool EytzingerSet<T, Alloc>::InOrder(Visitor&& visit) const
+{
+    for (size_t i = 0; i < count(); ++i)
+    {
+        const T& item = m_items[i];
+        if constexpr (std::is_void<decltype(visit(item))>::value)
+        {
+            visit(item);
+        }
+        else if (!visit(item))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- Lookup and Insertion ---
+template <class T, class Alloc>
+T* EytzingerSet<T, Alloc>::Find(const Key& key)
+{
+    size_t rank = boundRank<false>(key);
+    return (rank < count() && !(key < BstKey<T>::Get(m_items[rank]))) ? &m_items[rank] : nullptr;
+}
+
+template <class T, class Alloc>
+const T* EytzingerSet<T, Alloc>::Find(const Key& key) const
+{
+    size_t rank = boundRank<false>(key);
+    return (rank < count() && !(key < BstKey<T>::Get(m_items[rank]))) ? &m_items[rank] : nullptr;
+}
+
+template <class T, class Alloc>
+T* EytzingerSet<T, Alloc>::Search(const T& data)
+{
+    return Find(BstKey<T>::Get(data));
+}
+
+template <class T, class Alloc>
+const T* EytzingerSet<T, Alloc>::Search(const T& data) const
+{
+    return Find(BstKey<T>::Get(data));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+T* EytzingerSet<T, Alloc>::FindOrInsert(const Key& key, Args&&... args)
+{
+    size_t rank = boundRank<false>(key);
+    if (rank < count() && !(key < BstKey<T>::Get(m_items[rank])))
+    {
+        return &m_items[rank]; // Already present
+    }
+    m_items.emplace(m_items.begin() + rank, std::forward<Args>(args)...);
+    rebuildIndex();
+    return &m_items[rank];
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::Insert(const T& data)
+{
+    FindOrInsert(BstKey<T>::Get(data), data);
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::Insert(T&& data)
+{
+    FindOrInsert(BstKey<T>::Get(data), std::move(data));
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::DeleteNode(const T& deleteTarget)
+{
+    const Key& key = BstKey<T>::Get(deleteTarget);
+    size_t rank = boundRank<false>(key);
+    if (rank < count() && !(key < BstKey<T>::Get(m_items[rank])))
+    {
+        m_items.erase(m_items.begin() + rank);
+        rebuildIndex();
+    }
+}
+
+// --- Bulk Construction ---
+template <class T, class Alloc>
+template <class ForwardIt>
+bool EytzingerSet<T, Alloc>::BuildFromSorted(ForwardIt first, ForwardIt last)
+{
+    m_items.clear();
+    m_items.reserve(static_cast<size_t>(std::distance(first, last)));
+    for (; first != last; ++first)
+    {
+        if (!m_items.empty() && !(BstKey<T>::Get(m_items.back()) < BstKey<T>::Get(*first)))
+        {
+            m_items.clear(); // Out of order or repeated
+            rebuildIndex();
+            return false;
+        }
+        m_items.push_back(*first);
+    }
+    rebuildIndex();
+    return true;
+}
+
+template <class T, class Alloc>
+void EytzingerSet<T, Alloc>::Rebalance()
+{
+}
+
+template <class T, class Alloc>
+int EytzingerSet<T, Alloc>::GetHeight() const
+{
+    int height = 0;
+    for (size_t n = count(); n > 0; n >>= 1)
+    {
+        height++;
+    }
+    return height;
+}
+
+#endif // EYTZINGERSET_H_INCLUDED
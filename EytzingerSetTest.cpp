@@ -0,0 +1,131 @@
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+#include "Arena.h"
+#include "EytzingerSet.h"
+
+using namespace std;
+
+// Item looked up by its id alone
+struct Station
+{
+    Station(int i, const string& n) : id(i), name(n) {}
+    int id;
+    string name;
+};
+
+template <>
+struct BstKey<Station>
+{
+    typedef int KeyType;
+    static int Get(const Station& item)
+    {
+        return item.id;
+    }
+};
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static void collectVisit(int& item, void* userData)
+{
+    static_cast<vector<int>*>(userData)->push_back(item);
+}
+
+int main()
+{
+    cout << "--- EytzingerSet Unit Tests ---" << endl;
+
+    // 1. Random inserts and deletes agree with std::set
+    cout << "\n--- Random Insert / Delete Test ---" << endl;
+    EytzingerSet<int> randomSet;
+    set<int> reference;
+    srand(12345);
+    for (int i = 0; i < 20000; ++i)
+    {
+        int key = rand() % 2000;
+        if (rand() % 3 == 0)
+        {
+            randomSet.DeleteNode(key);
+            reference.erase(key);
+        }
+        else
+        {
+            randomSet.Insert(key);
+            reference.insert(key);
+        }
+    }
+    vector<int> inOrder;
+    randomSet.InOrder(collectVisit, &inOrder);
+    bool searchOk = true;
+    for (int key = -1; key <= 2000; ++key)
+    {
+        searchOk = searchOk && ((randomSet.Search(key) != nullptr) == (reference.count(key) == 1));
+    }
+    report("Random Insert / Delete Test", searchOk && inOrder == vector<int>(reference.begin(), reference.end()));
+
+    // 2. Bounds and ranges agree with std::set, including both ends
+    cout << "\n--- Bound / Range Test ---" << endl;
+    const EytzingerSet<int>& constSet = randomSet;
+    bool boundsOk = true;
+    for (int key = -1; key <= 2001; ++key)
+    {
+        set<int>::const_iterator lower = reference.lower_bound(key);
+        set<int>::const_iterator upper = reference.upper_bound(key);
+        boundsOk = boundsOk && (lower == reference.end() ? constSet.LowerBound(key) == constSet.end()
+                                                         : *constSet.LowerBound(key) == *lower);
+        boundsOk = boundsOk && (upper == reference.end() ? randomSet.UpperBound(key) == randomSet.end()
+                                                         : *randomSet.UpperBound(key) == *upper);
+    }
+    vector<int> inRange;
+    for (int key : constSet.GetRange(500, 599))
+    {
+        inRange.push_back(key);
+    }
+    report("Bound / Range Test", boundsOk && inRange == vector<int>(reference.lower_bound(500), reference.upper_bound(599)) &&
+           constSet.GetRange(9, 3).isEmpty());
+
+    // 3. Bulk construction, including sizes that do not fill the last level
+    cout << "\n--- Build From Sorted Test ---" << endl;
+    bool buildOk = true;
+    for (int n = 0; n <= 70; ++n)
+    {
+        vector<int> keys;
+        for (int i = 0; i < n; ++i)
+        {
+            keys.push_back(i * 3);
+        }
+        EytzingerSet<int> built;
+        buildOk = buildOk && built.BuildFromSorted(keys.begin(), keys.end()) && vector<int>(built.begin(), built.end()) == keys;
+        for (int key = -1; key <= n * 3; ++key)
+        {
+            buildOk = buildOk && ((built.Find(key) != nullptr) == (key >= 0 && key % 3 == 0 && key < n * 3));
+        }
+    }
+    vector<int> unsortedKeys = {1, 3, 3, 5};
+    EytzingerSet<int> rejectedSet;
+    bool rejected = !rejectedSet.BuildFromSorted(unsortedKeys.begin(), unsortedKeys.end()) && rejectedSet.isEmpty();
+    report("Build From Sorted Test", buildOk && rejected);
+
+    // 4. Key lookups with an arena allocator, and early stop
+    cout << "\n--- Find Or Insert Test ---" << endl;
+    Arena arena;
+    EytzingerSet<Station, ArenaAllocator<Station>> stations{ArenaAllocator<Station>(&arena)};
+    for (int i = 99; i >= 0; --i)
+    {
+        stations.FindOrInsert(i, i, "station");
+    }
+    Station* perth = stations.FindOrInsert(7, 7, "ignored");
+    perth->name = "Perth";
+    int visited = 0;
+    bool stopped = !stations.InOrder([&visited](const Station& station) { visited++; return station.id < 9; });
+    report("Find Or Insert Test", stations.Find(7)->name == "Perth" && stations.Find(100) == nullptr &&
+           stopped && visited == 10 && stations.GetHeight() == 7 && arena.GetBlockCount() == 1);
+
+    cout << "\n--- End of EytzingerSet Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,297 @@
+#include "FileFollower.h"
+#include "Types.h"
+#include "InputFile.h"
+#include <algorithm>
+#include <iostream>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using std::cerr;
+using std::endl;
+
+// Size and identity of a file; false if it does not exist
+static bool statFile(const string& path, uint64_t& size, uint64_t& inode)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+    {
+        return false;
+    }
+    size = static_cast<uint64_t>(info.st_size);
+    inode = static_cast<uint64_t>(info.st_ino);
+    return true;
+}
+
+FileFollower::FileFollower()
+    : m_files(), m_directories(), m_tokenizer(CSV_DELIMITER), m_inotifyFd(-1), m_rejected(0)
+{
+#ifdef __linux__
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+FileFollower::~FileFollower()
+{
+#ifdef __linux__
+    if (m_inotifyFd >= 0)
+    {
+        close(m_inotifyFd);
+    }
+#endif
+}
+
+bool FileFollower::Watch(const string& path, uint64_t offset)
+{
+    uint64_t size;
+    uint64_t inode;
+    if (!statFile(path, size, inode))
+    {
+        return false;
+    }
+    if (InputFile::IsGzipFile(path))
+    {
+        // Offsets into a gzip stream cannot be resumed from, and loggers do not append to one
+        cerr << "Note: " << path << " is gzip-compressed; not following it." << endl;
+        return false;
+    }
+
+    FollowedFile file;
+    file.path = path;
+    size_t slash = path.find_last_of('/');
+    file.directory = (slash == string::npos) ? "." : path.substr(0, slash);
+    file.name = (slash == string::npos) ? path : path.substr(slash + 1);
+    file.inode = inode;
+    file.stream.open(path, std::ios::binary);
+    if (!file.stream.is_open())
+    {
+        return false;
+    }
+
+    // Resolve the columns now; without a complete header the file is read from the start later
+    string headerLine;
+    if (offset > 0 && getline(file.stream, headerLine) && !file.stream.eof())
+    {
+        m_tokenizer.Tokenize(headerLine);
+        if (!RecordParser::ResolveColumns(m_tokenizer, file.layout))
+        {
+            return false;
+        }
+        file.hasLayout = true;
+        file.offset = std::max<uint64_t>(offset, headerLine.size() + 1);
+    }
+    file.dirty = true; // Rows may have been appended since the load
+
+#ifdef __linux__
+    if (m_inotifyFd >= 0)
+    {
+        bool watched = false;
+        for (std::map<int, string>::const_iterator it = m_directories.begin(); it != m_directories.end(); ++it)
+        {
+            watched = watched || (it->second == file.directory);
+        }
+        if (!watched)
+        {
+            // Watch the directory rather than the file, so a rotated file is seen under its name again
+            int wd = inotify_add_watch(m_inotifyFd, file.directory.c_str(),
+                                       IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO);
+            if (wd >= 0)
+            {
+                m_directories[wd] = file.directory;
+            }
+            else
+            {
+                close(m_inotifyFd); // Fall back to checking every file
+                m_inotifyFd = -1;
+            }
+        }
+    }
+#endif
+
+    m_files[path] = std::move(file);
+    return true;
+}
+
+int FileFollower::WatchLoadedFiles(const IngestReport& report)
+{
+    int watched = 0;
+    for (int i = 0; i < report.getCount(); ++i)
+    {
+        const FileIngestStats& stats = report.GetFile(i);
+        if (stats.loaded && Watch(DATA_FOLDER + stats.filename, stats.followOffset))
+        {
+            watched++;
+        }
+    }
+    return watched;
+}
+
+// Marks the files named in pending inotify events (or every file without inotify) as dirty
+void FileFollower::drainEvents()
+{
+#ifdef __linux__
+    if (m_inotifyFd >= 0)
+    {
+        alignas(struct inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(m_inotifyFd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* p = buffer; p < buffer + length;)
+            {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(p);
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    for (std::map<string, FollowedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+                    {
+                        it->second.dirty = true;
+                    }
+                }
+                else if (event->len > 0)
+                {
+                    std::map<int, string>::const_iterator dir = m_directories.find(event->wd);
+                    if (dir != m_directories.end())
+                    {
+                        string path = (dir->second == ".") ? string(event->name) : dir->second + "/" + event->name;
+                        std::map<string, FollowedFile>::iterator it = m_files.find(path);
+                        if (it != m_files.end())
+                        {
+                            it->second.dirty = true;
+                        }
+                    }
+                }
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+        return;
+    }
+#endif
+    for (std::map<string, FollowedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+    {
+        it->second.dirty = true;
+    }
+}
+
+int FileFollower::Poll(WeatherDatabase& weatherRecords)
+{
+    drainEvents();
+
+    int recordsAdded = 0;
+    for (std::map<string, FollowedFile>::iterator it = m_files.begin(); it != m_files.end(); ++it)
+    {
+        FollowedFile& file = it->second;
+        if (file.dirty && !file.failed)
+        {
+            file.dirty = false;
+            recordsAdded += readNewRows(file, weatherRecords);
+        }
+    }
+    return recordsAdded;
+}
+
+int FileFollower::readNewRows(FollowedFile& file, WeatherDatabase& weatherRecords)
+{
+    // 1. Rows added to the open file, including any written just before it was rotated away
+    int recordsAdded = parseAppended(file, weatherRecords);
+
+    // 2. A new file under the same name: once the old one is drained, start again from its header
+    uint64_t size;
+    uint64_t inode;
+    if (!file.failed && statFile(file.path, size, inode) && inode != file.inode)
+    {
+        file.stream.close();
+        file.stream.clear();
+        file.stream.open(file.path, std::ios::binary);
+        file.inode = inode;
+        file.offset = 0;
+        file.hasLayout = false;
+        recordsAdded += parseAppended(file, weatherRecords);
+    }
+    return recordsAdded; // A missing file is between rotation steps; the new file will raise an event
+}
+
+// Parses the complete lines of the open file past the offset
+int FileFollower::parseAppended(FollowedFile& file, WeatherDatabase& weatherRecords)
+{
+    if (!file.stream.is_open())
+    {
+        return 0;
+    }
+    file.stream.clear(); // Reading up to the end last time set eofbit
+    file.stream.seekg(0, std::ios::end);
+    std::streamoff fileEnd = file.stream.tellg();
+    if (fileEnd < 0)
+    {
+        return 0;
+    }
+    uint64_t size = static_cast<uint64_t>(fileEnd);
+
+    // Truncated: start again from its header
+    if (size < file.offset)
+    {
+        file.offset = 0;
+        file.hasLayout = false;
+    }
+    if (size == file.offset)
+    {
+        return 0;
+    }
+
+    string bytes(static_cast<size_t>(size - file.offset), '\0');
+    file.stream.seekg(static_cast<std::streamoff>(file.offset));
+    file.stream.read(&bytes[0], static_cast<std::streamsize>(bytes.size()));
+    bytes.resize(static_cast<size_t>(file.stream.gcount()));
+    size_t lastNewline = bytes.rfind('\n');
+    if (lastNewline == string::npos)
+    {
+        return 0; // Only a partial line so far
+    }
+
+    int recordsAdded = 0;
+    WeatherRecord record;
+    const char* p = bytes.data();
+    const char* end = p + lastNewline + 1;
+    while (p < end)
+    {
+        const char* lineEnd = RecordParser::FindLineEnd(p, end);
+        m_tokenizer.Tokenize(string_view(p, static_cast<size_t>(lineEnd - p)));
+        p = lineEnd + 1;
+
+        if (!file.hasLayout)
+        {
+            if (!RecordParser::ResolveColumns(m_tokenizer, file.layout))
+            {
+                cerr << "Error: " << file.path << " no longer has the required columns; not following it." << endl;
+                file.failed = true;
+                return recordsAdded;
+            }
+            file.hasLayout = true;
+            continue;
+        }
+
+        RowStatus status = RecordParser::ParseRow(m_tokenizer, file.layout, record);
+        if (status == RowStatus::Ok)
+        {
+            weatherRecords.Insert(record);
+            recordsAdded++;
+        }
+        else if (status != RowStatus::Incomplete)
+        {
+            m_rejected++;
+        }
+    }
+
+    file.offset += lastNewline + 1;
+    return recordsAdded;
+}
+
+long FileFollower::GetRejectedCount() const
+{
+    return m_rejected;
+}
+
+bool FileFollower::IsUsingInotify() const
+{
+    return m_inotifyFd >= 0;
+}
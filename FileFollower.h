@@ -0,0 +1,112 @@
+#ifndef FILEFOLLOWER_H_INCLUDED
+#define FILEFOLLOWER_H_INCLUDED
+
+#include "WeatherDatabase.h"
+#include "RecordParser.h"
+#include "CsvTokenizer.h"
+#include "IngestReport.h"
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
+using std::string;
+
+/**
+ * @struct FollowedFile
+ * @brief Read position and column layout of one CSV being followed.
+ */
+struct FollowedFile
+{
+    string path;            //!< Path as passed to Watch.
+    string directory;       //!< Directory part of the path ("." if none).
+    string name;            //!< File name part of the path.
+    std::ifstream stream;   //!< The file, kept open so rows written just before a rotation are still read.
+    uint64_t offset = 0;    //!< Start of the first byte not yet parsed (always a line start).
+    uint64_t inode = 0;     //!< Identity of the open file, to detect rotation.
+    bool hasLayout = false; //!< False until the header of the current file has been read.
+    bool failed = false;    //!< True if the header lacks a required column; the file is ignored.
+    bool dirty = true;      //!< True if the file may have changed since the last Poll.
+    ColumnLayout layout;    //!< Columns resolved from the header.
+};
+
+/**
+ * @class FileFollower
+ * @brief Picks up rows appended to CSV files after they were loaded ("tail -f").
+ *
+ * Each followed file keeps the offset of the first unparsed byte. Poll reads
+ * only the bytes past that offset and inserts the complete lines into a
+ * WeatherDatabase. A final line without its newline is left for the next Poll,
+ * so a row the logger is still writing is never parsed half-finished.
+ *
+ * Each file is kept open. When a new file appears under the same name (rotation),
+ * the rest of the old file is read first, then the new one from its header on.
+ * A file that becomes shorter than the offset was truncated and is read again
+ * from the start.
+ *
+ * Only plain CSV files can be followed: gzip-compressed files are skipped by
+ * Watch with a note on cerr.
+ *
+ * On Linux the directories of the followed files are watched with inotify and
+ * Poll only looks at files named in an event. Elsewhere, or if inotify is not
+ * available, every file is checked with stat() on each Poll.
+ */
+class FileFollower
+{
+public:
+    FileFollower();
+    ~FileFollower();
+
+    FileFollower(const FileFollower&) = delete;
+    FileFollower& operator=(const FileFollower&) = delete;
+
+    /**
+     * @brief Starts following a file from the end of the rows already loaded.
+     * Rows appended since the load are picked up by the next Poll.
+     * @param path The file path.
+     * @param offset Where the unread rows start, normally FileIngestStats::followOffset
+     * (0: read the whole file, header included).
+     * @return true if the file exists, is not gzip-compressed and its header, if complete, has the required columns.
+     */
+    bool Watch(const string& path, uint64_t offset);
+
+    /**
+     * @brief Follows every file loaded by Controller::LoadAllRecordsFromSourceFile, each from its
+     * FileIngestStats::followOffset. Files that failed to load are skipped.
+     * @param report The report filled in by the load.
+     * @return The number of files being followed.
+     */
+    int WatchLoadedFiles(const IngestReport& report);
+
+    /**
+     * @brief Inserts the rows appended since the last call. Never blocks.
+     * @param weatherRecords The database to insert into.
+     * @return The number of records inserted.
+     */
+    int Poll(WeatherDatabase& weatherRecords);
+
+    /**
+     * @brief Gets the number of appended rows that could not be parsed.
+     * @return The rejected row count since the follower was created.
+     */
+    long GetRejectedCount() const;
+
+    /**
+     * @brief Checks whether change notifications come from inotify.
+     * @return false if every Poll falls back to checking each file.
+     */
+    bool IsUsingInotify() const;
+
+private:
+    void drainEvents();
+    int readNewRows(FollowedFile& file, WeatherDatabase& weatherRecords);
+    int parseAppended(FollowedFile& file, WeatherDatabase& weatherRecords);
+
+    std::map<string, FollowedFile> m_files; //!< Followed files keyed by path.
+    std::map<int, string> m_directories;    //!< inotify watch descriptor -> directory.
+    CsvTokenizer m_tokenizer;               //!< Re-used field table.
+    int m_inotifyFd;                        //!< inotify instance, or -1.
+    long m_rejected;                        //!< Appended rows that failed to parse.
+};
+
+#endif // FILEFOLLOWER_H_INCLUDED
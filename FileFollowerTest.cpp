@@ -0,0 +1,103 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include "Controller.h"
+#include "FileFollower.h"
+
+using namespace std;
+
+const char* TEST_FILE = "follow_test.csv";
+const char* ROTATED_FILE = "follow_test.csv.1";
+const char* HEADER = "WAST,S,T,SR\n";
+
+static void appendText(const char* path, const string& text, bool truncate = false)
+{
+    ofstream out(path, truncate ? ios::binary | ios::trunc : ios::binary | ios::app);
+    out << text;
+}
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+int main()
+{
+    cout << "--- FileFollower Unit Tests ---" << endl;
+
+    remove(TEST_FILE);
+    remove(ROTATED_FILE);
+
+    const string loadedPart = string(HEADER) + "1/01/2007 9:00,6,22.75,664\n1/01/2007 9:10,5,23.3,702\n";
+    appendText(TEST_FILE, loadedPart + "1/01/2007 9:2", true);
+
+    // 1. Every loader stops before a last line still being written and says where it stopped
+    cout << "\n--- Load Offset Test ---" << endl;
+    bool offsetsOk = true;
+    for (LoadMode mode : {LoadMode::Stream, LoadMode::Mapped, LoadMode::Pipelined})
+    {
+        Controller controller;
+        controller.SetLoadMode(mode);
+        controller.SetSkipUnfinishedLine(true);
+        WeatherDatabase loaded;
+        FileIngestStats loadedStats;
+        offsetsOk = offsetsOk && controller.LoadRecords(loaded, TEST_FILE, loadedStats) == 2
+                    && loadedStats.followOffset == loadedPart.size();
+    }
+    report("Load Offset Test", offsetsOk);
+
+    WeatherDatabase database;
+    Controller controller;
+    controller.SetSkipUnfinishedLine(true);
+    FileIngestStats stats;
+    controller.LoadRecords(database, TEST_FILE, stats);
+    FileFollower follower;
+
+    // 2. Rows finished or appended between the load and Watch are read, none of them twice
+    cout << "\n--- Watch Test ---" << endl;
+    appendText(TEST_FILE, "0,5,23.5,710\n");
+    bool watching = follower.Watch(TEST_FILE, stats.followOffset);
+    bool caughtUp = follower.Poll(database) == 1;
+    report("Watch Test", watching && caughtUp && follower.Poll(database) == 0
+           && database.GetRecordCount() == 3);
+
+    // 3. A complete row is loaded, a half-written one waits
+    cout << "\n--- Append Test ---" << endl;
+    appendText(TEST_FILE, "1/01/2007 9:30,5,23.5,710\n1/01/2007 9:4");
+    report("Append Test", follower.Poll(database) == 1);
+
+    cout << "\n--- Partial Line Test ---" << endl;
+    appendText(TEST_FILE, "0,4,23.9,720\n");
+    int added = follower.Poll(database);
+    const MonthColumns* month = database.GetMonthData(2007, 1);
+    bool partialOk = added == 1 && month != nullptr && month->GetDayEnd(1) - month->GetDayBegin(1) == 5
+                     && month->GetRecord(month->GetDayBegin(1) + 4).GetTime().GetMinute() == 40;
+    report("Partial Line Test", partialOk);
+
+    // 4. Rotation: rows written to the old file before it moved away are read, then the new file
+    cout << "\n--- Rotation Test ---" << endl;
+    appendText(TEST_FILE, "1/01/2007 9:50,4,24.0,725\n");
+    rename(TEST_FILE, ROTATED_FILE);
+    appendText(TEST_FILE, string(HEADER) + "1/01/2007 10:00,4,24.1,730\n", true);
+    report("Rotation Test", follower.Poll(database) == 2 && database.GetRecordCount() == 7);
+
+    // 5. Truncation: the file is emptied down to its header and written again
+    cout << "\n--- Truncation Test ---" << endl;
+    appendText(TEST_FILE, HEADER, true);
+    bool truncated = follower.Poll(database) == 0;
+    appendText(TEST_FILE, "1/01/2007 10:10,4,24.4,740\n");
+    report("Truncation Test", truncated && follower.Poll(database) == 1);
+
+    // 6. Bad rows are counted, not inserted
+    cout << "\n--- Bad Row Test ---" << endl;
+    appendText(TEST_FILE, "1/01/2007 10:20,abc,24.4,740\n");
+    report("Bad Row Test", follower.Poll(database) == 0 && follower.GetRejectedCount() == 1);
+
+    cout << "(change notifications: " << (follower.IsUsingInotify() ? "inotify" : "polling") << ")" << endl;
+
+    remove(TEST_FILE);
+    remove(ROTATED_FILE);
+
+    cout << "\n--- End of FileFollower Unit Tests ---" << endl;
+    return 0;
+}
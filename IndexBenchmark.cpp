@@ -0,0 +1,88 @@
+// Lookup latency of the ordered containers WeatherDatabase can index with: Bst (AVL) versus EytzingerSet,
+// with std::lower_bound over a sorted array as a baseline.
+// Build (from the project folder):
+//   g++ -std=c++17 -O2 IndexBenchmark.cpp -o IndexBenchmark
+// Usage: IndexBenchmark [largest key count, default 10000000]
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Bst.h"
+#include "EytzingerSet.h"
+
+using namespace std;
+
+const int LOOKUPS = 1000000;
+
+// Times LOOKUPS finds and returns the average in nanoseconds; hits are counted so the work is not optimised away
+template <class Lookup>
+static double timeLookups(const vector<int>& queries, Lookup lookup, long& hits)
+{
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        hits += lookup(queries[i]) ? 1 : 0;
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(stop - start).count() / queries.size();
+}
+
+int main(int argc, char* argv[])
+{
+    long largest = (argc > 1) ? atol(argv[1]) : 10000000;
+
+    cout << "--- Index Benchmark ---" << endl;
+    cout << LOOKUPS << " random lookups per size, about half of them hits (ns per lookup)" << endl;
+    cout << setw(10) << "keys" << setw(14) << "Bst (AVL)" << setw(14) << "Eytzinger" << setw(14) << "sorted array" << endl;
+
+    mt19937 random(12345);
+    for (long n = 1000; n <= largest; n *= 10)
+    {
+        // Keys are the even numbers below 2n
+        vector<int> keys(n);
+        for (long i = 0; i < n; ++i)
+        {
+            keys[i] = static_cast<int>(2 * i);
+        }
+        uniform_int_distribution<int> pick(0, static_cast<int>(2 * n - 1));
+        vector<int> queries(LOOKUPS);
+        for (int i = 0; i < LOOKUPS; ++i)
+        {
+            queries[i] = pick(random);
+        }
+
+        // Insert in random order, as a tree filled over time would be: nodes end up scattered in memory
+        vector<int> insertOrder(keys);
+        shuffle(insertOrder.begin(), insertOrder.end(), random);
+        Bst<int, std::allocator<int>, BstBalance::Avl> tree;
+        for (long i = 0; i < n; ++i)
+        {
+            tree.Insert(insertOrder[i]);
+        }
+        EytzingerSet<int> eytzinger;
+        eytzinger.BuildFromSorted(keys.begin(), keys.end());
+
+        long treeHits = 0;
+        long eytzingerHits = 0;
+        long arrayHits = 0;
+        double treeNs = timeLookups(queries, [&tree](int key) { return tree.Find(key) != nullptr; }, treeHits);
+        double eytzingerNs = timeLookups(queries, [&eytzinger](int key) { return eytzinger.Find(key) != nullptr; },
+                                         eytzingerHits);
+        double arrayNs = timeLookups(queries, [&keys](int key) { return binary_search(keys.begin(), keys.end(), key); },
+                                     arrayHits);
+
+        cout << setw(10) << n << fixed << setprecision(1) << setw(14) << treeNs << setw(14) << eytzingerNs
+             << setw(14) << arrayNs;
+        if (treeHits != eytzingerHits || treeHits != arrayHits)
+        {
+            cout << "  (hit counts differ!)";
+        }
+        cout << endl;
+    }
+
+    cout << "--- End of Index Benchmark ---" << endl;
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include "IngestReport.h"
+#include <iomanip>
+
+using std::endl;
+using std::fixed;
+using std::setprecision;
+
+void FileIngestStats::AddIssue(RowStatus status, long lineNumber)
+{
+    long& count = issueCounts[static_cast<int>(status)];
+    if (count < MAX_SAMPLE_LINES)
+    {
+        sampleLines[static_cast<int>(status)][count] = lineNumber;
+    }
+    count++;
+}
+
+void FileIngestStats::AddMessage(const string& message)
+{
+    messages += message;
+    messages += '\n';
+}
+
+void FileIngestStats::Append(const FileIngestStats& later, long lineOffset)
+{
+    rowsAccepted += later.rowsAccepted;
+    bytes += later.bytes;
+    messages += later.messages;
+    for (int s = 0; s < ROW_STATUS_COUNT; ++s)
+    {
+        long kept = (later.issueCounts[s] < MAX_SAMPLE_LINES) ? later.issueCounts[s] : MAX_SAMPLE_LINES;
+        for (long i = 0; i < kept; ++i)
+        {
+            if (issueCounts[s] < MAX_SAMPLE_LINES)
+            {
+                sampleLines[s][issueCounts[s]] = later.sampleLines[s][i] + lineOffset;
+            }
+            issueCounts[s]++;
+        }
+        issueCounts[s] += later.issueCounts[s] - kept;
+    }
+}
+
+long FileIngestStats::GetRejectedCount() const
+{
+    long total = 0;
+    for (int s = 0; s < ROW_STATUS_COUNT; ++s)
+    {
+        total += issueCounts[s];
+    }
+    return total;
+}
+
+void IngestReport::AddFile(const FileIngestStats& stats)
+{
+    m_files.PushBack(stats);
+}
+
+int IngestReport::getCount() const
+{
+    return m_files.getCount();
+}
+
+const FileIngestStats& IngestReport::GetFile(int index) const
+{
+    return m_files[index];
+}
+
+long IngestReport::GetIssueCount(RowStatus status) const
+{
+    long total = 0;
+    for (int i = 0; i < m_files.getCount(); ++i)
+    {
+        total += m_files[i].issueCounts[static_cast<int>(status)];
+    }
+    return total;
+}
+
+const char* IngestReport::GetIssueName(RowStatus status)
+{
+    switch (status)
+    {
+    case RowStatus::Incomplete:
+        return "blank or short";
+    case RowStatus::BadNumber:
+        return "non-numeric";
+    case RowStatus::OutOfRange:
+        return "out of range";
+    default:
+        return "ok";
+    }
+}
+
+void IngestReport::Print(ostream& out) const
+{
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    long totalRows = 0;
+    long totalRejected = 0;
+    int failedFiles = 0;
+
+    out << "Ingest report:" << endl;
+    for (int i = 0; i < m_files.getCount(); ++i)
+    {
+        const FileIngestStats& file = m_files[i];
+        if (!file.loaded)
+        {
+            out << "  " << file.filename << ": not loaded" << endl;
+            failedFiles++;
+            continue;
+        }
+
+        double seconds = (file.seconds > 0.0) ? file.seconds : 1e-9;
+        out << "  " << file.filename << ": " << file.rowsAccepted << " rows, "
+            << fixed << setprecision(2) << file.bytes / 1e6 << " MB in " << setprecision(3) << file.seconds << " s ("
+            << setprecision(0) << file.rowsAccepted / seconds << " rows/s, "
+            << setprecision(1) << file.bytes / 1e6 / seconds << " MB/s)" << endl;
+
+        for (int s = 1; s < ROW_STATUS_COUNT; ++s)
+        {
+            long count = file.issueCounts[s];
+            if (count == 0)
+            {
+                continue;
+            }
+            out << "    " << GetIssueName(static_cast<RowStatus>(s)) << ": " << count << " (line";
+            long shown = (count < MAX_SAMPLE_LINES) ? count : MAX_SAMPLE_LINES;
+            out << (shown > 1 ? "s " : " ");
+            for (long j = 0; j < shown; ++j)
+            {
+                out << (j > 0 ? ", " : "") << file.sampleLines[s][j];
+            }
+            out << (count > shown ? ", ...)" : ")") << endl;
+        }
+
+        totalRows += file.rowsAccepted;
+        totalRejected += file.GetRejectedCount();
+    }
+
+    out << "  Total: " << totalRows << " rows accepted, " << totalRejected << " rejected";
+    if (totalRejected > 0)
+    {
+        out << " (";
+        bool first = true;
+        for (int s = 1; s < ROW_STATUS_COUNT; ++s)
+        {
+            long count = GetIssueCount(static_cast<RowStatus>(s));
+            if (count > 0)
+            {
+                out << (first ? "" : ", ") << GetIssueName(static_cast<RowStatus>(s)) << " " << count;
+                first = false;
+            }
+        }
+        out << ")";
+    }
+    if (failedFiles > 0)
+    {
+        out << ", " << failedFiles << " file(s) not loaded";
+    }
+    out << endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
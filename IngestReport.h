@@ -0,0 +1,118 @@
+#ifndef INGESTREPORT_H_INCLUDED
+#define INGESTREPORT_H_INCLUDED
+
+#include "RecordParser.h"
+#include "Vector.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+using std::ostream;
+using std::string;
+
+/// @brief Number of RowStatus values; issue counters are indexed by RowStatus.
+const int ROW_STATUS_COUNT = 4;
+
+/// @brief Line numbers kept per failure category as examples.
+const int MAX_SAMPLE_LINES = 5;
+
+/**
+ * @struct FileIngestStats
+ * @brief What happened while loading one CSV file.
+ *
+ * Rejected rows are counted per RowStatus, and the line numbers of the first
+ * few of each kind are kept so they can be looked up; the rows themselves are
+ * not copied or printed. Errors about the file itself (missing, bad header,
+ * read failure) are collected in messages rather than printed, so files loaded
+ * on worker threads can be reported in list order.
+ */
+struct FileIngestStats
+{
+    string filename;                                       //!< File as listed in the source file.
+    bool loaded = false;                                   //!< False if the file could not be opened or had no usable header.
+    long rowsAccepted = 0;                                 //!< Rows turned into records.
+    uint64_t bytes = 0;                                    //!< Bytes of the file processed.
+    uint64_t followOffset = 0;                             //!< Just past the last complete line read (see FileFollower).
+    double seconds = 0.0;                                  //!< Wall time spent loading the file.
+    long issueCounts[ROW_STATUS_COUNT] = {};               //!< Rejected rows per RowStatus (Ok is unused).
+    long sampleLines[ROW_STATUS_COUNT][MAX_SAMPLE_LINES] = {}; //!< First line numbers of each kind.
+    string messages;                                       //!< Errors met while loading, one per line, for cerr.
+
+    /**
+     * @brief Counts a rejected row.
+     * @param status Why the row was rejected.
+     * @param lineNumber The row's line number (1 = header line), or relative to a chunk before Append.
+     */
+    void AddIssue(RowStatus status, long lineNumber);
+
+    /**
+     * @brief Keeps an error message to be printed with the file's load result.
+     * @param message The message, without a trailing newline.
+     */
+    void AddMessage(const string& message);
+
+    /**
+     * @brief Adds the counters and messages of a later part of the same file, e.g. a parallel chunk.
+     * @param later Counters whose line numbers are relative to that part.
+     * @param lineOffset Line number of the line before the part's first line.
+     */
+    void Append(const FileIngestStats& later, long lineOffset);
+
+    /**
+     * @brief Gets the number of rejected rows of all kinds.
+     * @return The total issue count.
+     */
+    long GetRejectedCount() const;
+};
+
+/**
+ * @class IngestReport
+ * @brief Per-file load statistics of one load, printed once when it finishes.
+ */
+class IngestReport
+{
+public:
+    /**
+     * @brief Adds the statistics of one file.
+     * @param stats The file's counters.
+     */
+    void AddFile(const FileIngestStats& stats);
+
+    /**
+     * @brief Gets the number of files in the report.
+     * @return The file count.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Gets the statistics of one file.
+     * @param index The file index, in load order.
+     * @return The file's counters.
+     */
+    const FileIngestStats& GetFile(int index) const;
+
+    /**
+     * @brief Gets the number of rows rejected for one reason across all files.
+     * @param status The failure category.
+     * @return The count.
+     */
+    long GetIssueCount(RowStatus status) const;
+
+    /**
+     * @brief Writes one block per file (throughput, issue counts, sample lines) and a total line.
+     * @param out The output stream.
+     */
+    void Print(ostream& out) const;
+
+    /**
+     * @brief Gets the printable name of a failure category.
+     * @param status The category.
+     * @return A short description, e.g. "non-numeric".
+     */
+    static const char* GetIssueName(RowStatus status);
+
+private:
+    Vector<FileIngestStats> m_files; //!< Files in load order.
+};
+
+#endif // INGESTREPORT_H_INCLUDED
@@ -0,0 +1,231 @@
+#include "InputFile.h"
+#include <algorithm>
+
+#include <zlib.h>
+
+// Compressed bytes read from disk per refill of the decoder
+const size_t INFLATE_INPUT_BYTES = 256 * 1024;
+
+// Bytes read ahead per refill of the ReadLine buffer
+const size_t LINE_READ_BYTES = 64 * 1024;
+
+/**
+ * @brief zlib stream and its compressed input buffer.
+ */
+struct InputFile::Inflater
+{
+    z_stream stream;                  //!< Decoder state.
+    std::unique_ptr<char[]> input;    //!< Compressed bytes not yet consumed.
+    bool finished = false;            //!< True once the last member has ended at end of file.
+};
+
+InputFile::InputFile() : m_file(), m_inflater(), m_bytesRead(0), m_lineBuffer(), m_linePos(0), m_lineEnded(false), m_error()
+{
+}
+
+InputFile::~InputFile()
+{
+    Close();
+}
+
+bool InputFile::IsGzipFile(const string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    unsigned char magic[2] = {0, 0};
+    file.read(reinterpret_cast<char*>(magic), 2);
+    return file.gcount() == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+}
+
+bool InputFile::Open(const string& filename)
+{
+    Close();
+
+    bool compressed = IsGzipFile(filename);
+    m_file.open(filename, std::ios::binary);
+    if (!m_file.is_open())
+    {
+        return false;
+    }
+    if (!compressed)
+    {
+        return true;
+    }
+
+    m_inflater.reset(new Inflater());
+    m_inflater->input.reset(new char[INFLATE_INPUT_BYTES]);
+    z_stream& stream = m_inflater->stream;
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.opaque = Z_NULL;
+    stream.next_in = Z_NULL;
+    stream.avail_in = 0;
+    if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) // 16: expect a gzip header
+    {
+        m_error = "Error: Could not start the gzip decoder for " + filename + ".";
+        m_inflater.reset();
+        m_file.close();
+        return false;
+    }
+    return true;
+}
+
+void InputFile::Close()
+{
+    if (m_inflater)
+    {
+        inflateEnd(&m_inflater->stream);
+    }
+    m_inflater.reset();
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+    m_file.clear();
+    m_bytesRead = 0;
+    m_lineBuffer.clear();
+    m_linePos = 0;
+    m_lineEnded = false;
+    m_error.clear();
+}
+
+bool InputFile::LastLineEnded() const
+{
+    return m_lineEnded;
+}
+
+bool InputFile::IsCompressed() const
+{
+    return m_inflater != nullptr;
+}
+
+unsigned long long InputFile::GetBytesRead() const
+{
+    return m_bytesRead;
+}
+
+const string& InputFile::GetError() const
+{
+    return m_error;
+}
+
+long InputFile::Read(char* buffer, size_t size)
+{
+    if (!m_file.is_open())
+    {
+        return -1;
+    }
+
+    // Hand out what ReadLine has already buffered first
+    size_t buffered = std::min(size, m_lineBuffer.size() - m_linePos);
+    m_lineBuffer.copy(buffer, buffered, m_linePos);
+    m_linePos += buffered;
+    if (buffered == size)
+    {
+        return static_cast<long>(size);
+    }
+
+    long got = readData(buffer + buffered, size - buffered);
+    return (got < 0) ? -1 : static_cast<long>(buffered) + got;
+}
+
+bool InputFile::ReadLine(string& line)
+{
+    line.clear();
+    m_lineEnded = false;
+    if (!m_file.is_open())
+    {
+        return false;
+    }
+
+    bool extracted = false;
+    while (true)
+    {
+        size_t newline = m_lineBuffer.find('\n', m_linePos);
+        if (newline != string::npos)
+        {
+            line.append(m_lineBuffer, m_linePos, newline - m_linePos);
+            m_linePos = newline + 1;
+            m_lineEnded = true;
+            return true;
+        }
+
+        // No complete line buffered: keep the partial one and refill
+        extracted = extracted || m_linePos < m_lineBuffer.size();
+        line.append(m_lineBuffer, m_linePos, string::npos);
+        m_lineBuffer.resize(LINE_READ_BYTES);
+        long got = readData(&m_lineBuffer[0], LINE_READ_BYTES);
+        m_lineBuffer.resize(got > 0 ? static_cast<size_t>(got) : 0);
+        m_linePos = 0;
+        if (got <= 0)
+        {
+            return got == 0 && extracted;
+        }
+    }
+}
+
+long InputFile::readData(char* buffer, size_t size)
+{
+    return m_inflater ? readCompressed(buffer, size) : readRaw(buffer, size);
+}
+
+long InputFile::readRaw(char* buffer, size_t size)
+{
+    m_file.read(buffer, static_cast<std::streamsize>(size));
+    long got = static_cast<long>(m_file.gcount());
+    if (m_file.bad())
+    {
+        m_error = "Error: Could not read from the file.";
+        return -1;
+    }
+    m_bytesRead += static_cast<unsigned long long>(got);
+    return got;
+}
+
+long InputFile::readCompressed(char* buffer, size_t size)
+{
+    Inflater& inflater = *m_inflater;
+    z_stream& stream = inflater.stream;
+    size_t produced = 0;
+
+    while (produced < size && !inflater.finished)
+    {
+        if (stream.avail_in == 0)
+        {
+            long got = readRaw(inflater.input.get(), INFLATE_INPUT_BYTES);
+            if (got < 0)
+            {
+                return -1;
+            }
+            if (got == 0)
+            {
+                // End of file: fine between members, an error inside one
+                inflater.finished = true;
+                if (stream.total_in > 0)
+                {
+                    m_error = "Error: Compressed data ends in the middle of a gzip member.";
+                    return -1;
+                }
+                break;
+            }
+            stream.next_in = reinterpret_cast<Bytef*>(inflater.input.get());
+            stream.avail_in = static_cast<uInt>(got);
+        }
+
+        stream.next_out = reinterpret_cast<Bytef*>(buffer + produced);
+        stream.avail_out = static_cast<uInt>(size - produced);
+        int status = inflate(&stream, Z_NO_FLUSH);
+        produced = size - stream.avail_out;
+
+        if (status == Z_STREAM_END)
+        {
+            // Another member may follow; reset keeps the unread input
+            inflateReset(&stream);
+        }
+        else if (status != Z_OK && status != Z_BUF_ERROR)
+        {
+            m_error = string("Error: Corrupt gzip data (") + (stream.msg != nullptr ? stream.msg : "inflate failed") + ").";
+            return -1;
+        }
+    }
+    return static_cast<long>(produced);
+}
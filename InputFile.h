@@ -0,0 +1,108 @@
+#ifndef INPUTFILE_H_INCLUDED
+#define INPUTFILE_H_INCLUDED
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using std::string;
+
+/**
+ * @class InputFile
+ * @brief Sequential binary reader that transparently inflates gzip files.
+ *
+ * Open() looks at the first two bytes: files starting with the gzip magic
+ * (0x1f 0x8b) are decompressed on the fly with zlib, anything else is read
+ * as is. Only a fixed-size compressed input buffer is held, so memory does
+ * not grow with the size of the file. Concatenated gzip members (as written
+ * by "cat a.gz b.gz") are read one after another.
+ *
+ * Nothing is printed: the reason for a failed Open or Read is available
+ * from GetError().
+ */
+class InputFile
+{
+public:
+    InputFile();
+    ~InputFile();
+
+    InputFile(const InputFile&) = delete;
+    InputFile& operator=(const InputFile&) = delete;
+
+    /**
+     * @brief Opens a plain or gzip-compressed file. Any open file is closed first.
+     * @param filename The file path.
+     * @return true if the file could be opened (and, if compressed, the decoder started).
+     */
+    bool Open(const string& filename);
+
+    /**
+     * @brief Closes the file and releases the decoder.
+     */
+    void Close();
+
+    /**
+     * @brief Reads the next bytes of the (decompressed) contents.
+     * @param buffer Destination buffer.
+     * @param size Maximum number of bytes to read.
+     * @return The number of bytes read (less than size only at the end), or -1 on a read or decode error.
+     */
+    long Read(char* buffer, size_t size);
+
+    /**
+     * @brief Reads the next line, like getline. Lines are cut from an internal
+     * buffer; Read() returns any bytes already buffered before reading further.
+     * @param line Receives the line without its '\n'.
+     * @return true if a line (possibly the unterminated last one) was read, false at the end or on error.
+     */
+    bool ReadLine(string& line);
+
+    /**
+     * @brief Checks whether the line returned by the last ReadLine ended with '\n'.
+     * @return false for an unterminated last line, e.g. one still being written.
+     */
+    bool LastLineEnded() const;
+
+    /**
+     * @brief Checks whether the open file is gzip-compressed.
+     * @return true if the contents are being inflated.
+     */
+    bool IsCompressed() const;
+
+    /**
+     * @brief Gets the number of bytes read from disk so far (compressed bytes for gzip files).
+     * @return The byte count.
+     */
+    unsigned long long GetBytesRead() const;
+
+    /**
+     * @brief Gets the reason the last Open or Read failed, if it was more than the file missing.
+     * @return The error message, or an empty string.
+     */
+    const string& GetError() const;
+
+    /**
+     * @brief Checks a file for the gzip magic bytes without opening it for reading.
+     * @param filename The file path.
+     * @return true if the file exists and starts with 0x1f 0x8b.
+     */
+    static bool IsGzipFile(const string& filename);
+
+private:
+    struct Inflater;
+
+    long readData(char* buffer, size_t size);
+    long readRaw(char* buffer, size_t size);
+    long readCompressed(char* buffer, size_t size);
+
+    std::ifstream m_file;                //!< The file on disk.
+    std::unique_ptr<Inflater> m_inflater; //!< zlib state, only for gzip files.
+    unsigned long long m_bytesRead;      //!< Bytes read from disk.
+    string m_lineBuffer;                 //!< Contents read ahead by ReadLine.
+    size_t m_linePos;                    //!< Start of the unconsumed part of m_lineBuffer.
+    bool m_lineEnded;                    //!< True if the last ReadLine found the line's '\n'.
+    string m_error;                      //!< Reason for the last failure (see GetError).
+};
+
+#endif // INPUTFILE_H_INCLUDED
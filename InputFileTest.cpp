@@ -0,0 +1,107 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <iterator>
+#include <zlib.h>
+#include "InputFile.h"
+
+using namespace std;
+
+const char* PLAIN_FILE = "input_test.csv";
+const char* GZIP_FILE = "input_test.csv.gz";
+
+static void writePlain(const char* path, const string& text)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    out << text;
+}
+
+// Appends one gzip member, so calling it twice gives a multi-member file
+static void writeGzipMember(const char* path, const string& text, bool truncate)
+{
+    gzFile out = gzopen(path, truncate ? "wb" : "ab");
+    gzwrite(out, text.data(), static_cast<unsigned>(text.size()));
+    gzclose(out);
+}
+
+// Reads the whole file in small pieces to cross buffer boundaries
+static bool readAll(const char* path, string& contents)
+{
+    InputFile file;
+    if (!file.Open(path))
+    {
+        return false;
+    }
+
+    contents.clear();
+    char buffer[7];
+    long got;
+    while ((got = file.Read(buffer, sizeof(buffer))) > 0)
+    {
+        contents.append(buffer, static_cast<size_t>(got));
+    }
+    return got == 0;
+}
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+int main()
+{
+    cout << "--- InputFile Unit Tests ---" << endl;
+
+    string text = "WAST,S,T,SR\n";
+    for (int i = 0; i < 5000; ++i)
+    {
+        text += "1/01/2007 9:" + to_string(i % 60) + ",6,22.75,664\n";
+    }
+    string contents;
+
+    // 1. Plain files are passed through unchanged
+    cout << "\n--- Plain File Test ---" << endl;
+    writePlain(PLAIN_FILE, text);
+    bool plainOk = readAll(PLAIN_FILE, contents) && contents == text && !InputFile::IsGzipFile(PLAIN_FILE);
+    report("Plain File Test", plainOk);
+
+    // 2. Gzip files are recognised by their magic bytes and inflated
+    cout << "\n--- Gzip File Test ---" << endl;
+    writeGzipMember(GZIP_FILE, text, true);
+    bool gzipOk = InputFile::IsGzipFile(GZIP_FILE) && readAll(GZIP_FILE, contents) && contents == text;
+    report("Gzip File Test", gzipOk);
+
+    // 3. Concatenated members read as one stream
+    cout << "\n--- Multi-Member Test ---" << endl;
+    writeGzipMember(GZIP_FILE, "second member\n", false);
+    report("Multi-Member Test", readAll(GZIP_FILE, contents) && contents == text + "second member\n");
+
+    // 4. Lines come out the same as getline, including an unterminated last line
+    cout << "\n--- Read Line Test ---" << endl;
+    writeGzipMember(GZIP_FILE, "a,b\n\nlast", true);
+    InputFile lines;
+    string line;
+    bool linesOk = lines.Open(GZIP_FILE) && lines.IsCompressed()
+                   && lines.ReadLine(line) && line == "a,b"
+                   && lines.ReadLine(line) && line.empty()
+                   && lines.ReadLine(line) && line == "last"
+                   && !lines.ReadLine(line);
+    report("Read Line Test", linesOk);
+
+    // 5. A member cut short is an error, not a silent end of file
+    cout << "\n--- Truncated File Test ---" << endl;
+    writeGzipMember(GZIP_FILE, text, true);
+    string compressed;
+    {
+        ifstream in(GZIP_FILE, ios::binary);
+        compressed.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }
+    writePlain(GZIP_FILE, compressed.substr(0, compressed.size() / 2));
+    report("Truncated File Test", !readAll(GZIP_FILE, contents));
+
+    remove(PLAIN_FILE);
+    remove(GZIP_FILE);
+
+    cout << "\n--- End of InputFile Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef MAPPEDFILE_H_INCLUDED
+#define MAPPEDFILE_H_INCLUDED
+
+#include <string>
+#include <cstddef>
+
+using std::string;
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The file contents are exposed as a contiguous byte range that stays valid
+ * until Close() is called or the object is destroyed. The bytes are NOT
+ * null-terminated, so callers must always respect GetSize().
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Default constructor. Creates an unmapped (closed) object.
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor. Unmaps the file if it is still open.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Maps the given file read-only into memory.
+     * Any previously mapped file is closed first. An empty file opens
+     * successfully with a null data pointer and a size of 0.
+     * @param filename The path of the file to map.
+     * @return true on success, false if the file could not be opened or mapped.
+     */
+    bool Open(const string& filename);
+
+    /**
+     * @brief Unmaps the file and releases the underlying handles.
+     */
+    void Close();
+
+    /**
+     * @brief Checks if a file is currently mapped.
+     * @return true if Open() succeeded and Close() has not been called.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets a pointer to the first byte of the mapped file.
+     * @return Pointer to the mapped bytes, or nullptr for an empty/closed file.
+     */
+    const char* GetData() const;
+
+    /**
+     * @brief Gets the number of mapped bytes.
+     * @return The file size in bytes.
+     */
+    size_t GetSize() const;
+
+private:
+    // A mapping owns OS handles, so copying is disabled.
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* m_data; //!< Start of the mapped view.
+    size_t m_size;      //!< Length of the mapped view in bytes.
+    bool m_isOpen;      //!< True while a file is mapped.
+#ifdef _WIN32
+    void* m_fileHandle;    //!< Win32 file HANDLE.
+    void* m_mappingHandle; //!< Win32 file-mapping HANDLE.
+#endif
+};
+
+#endif // MAPPEDFILE_H_INCLUDED
@@ -20,26 +20,6 @@ using std::stoi;
 using std::stof;
 using std::getline;
 
-static Vector<WeatherRecord> AggregateMonthRecords(const DayMap* dayMap)
-{
-    Vector<WeatherRecord> aggregatedRecords;
-    if (dayMap == nullptr)
-    {
-        return aggregatedRecords;
-    }
-
-    for (DayMap::const_iterator it = dayMap->begin(); it != dayMap->end(); ++it)
-    {
-        const Vector<WeatherRecord>& dayVector = it->second;
-
-        for (int i = 0; i < dayVector.getCount(); ++i)
-        {
-            aggregatedRecords.Insert(dayVector[i], aggregatedRecords.getCount());
-        }
-    }
-    return aggregatedRecords;
-}
-
 /**
  * @brief struct to hold data for the sPCC collector.
  */
@@ -54,36 +34,29 @@ struct SPCC_Collector
 };
 
 /**
- * @brief The "visit" function (static) to be passed to the BST traversal.
+ * @brief Adds one year's data for the collector's target month to the collector.
  *
- * This function is called for EVERY YearData node in the main BST.
+ * Called from displaySPCC's traversal for EVERY YearData node in the main BST.
  * It checks if that year has data for the 'targetMonth' and, if so,
  * collects all S, T, and R values into the collector struct.
  */
-static void sPCC_Visit_Func(YearData& yearData, void* userData)
+static void collectSPCC(const YearData& yearData, SPCC_Collector& collector)
 {
-    SPCC_Collector* collector = static_cast<SPCC_Collector*>(userData);
-
     // 1. Search this Year's monthTree for the target month
-    MonthData searchMonth;
-    searchMonth.month = collector->targetMonth;
-    MonthData* monthNode = yearData.monthTree.Search(searchMonth);
+    const MonthData* monthNode = yearData.monthTree.Find(collector.targetMonth);
 
     if (monthNode != nullptr)
     {
-        // 2. Found the month. Iterate through its DayMap.
-        for (DayMap::const_iterator it = monthNode->dayData.begin(); it != monthNode->dayData.end(); ++it)
+        // 2. Found the month. Add its sensor columns to the collector's vectors
+        const MonthColumns& columns = monthNode->columns;
+        const float* speeds = columns.GetColumn(Sensor::S);
+        const float* temperatures = columns.GetColumn(Sensor::T);
+        const float* radiations = columns.GetColumn(Sensor::SR);
+        for (int i = 0; i < columns.getCount(); ++i)
         {
-            const Vector<WeatherRecord>& dayVector = it->second;
-
-            // 3. Add every record's data to the collector's vectors
-            for (int i = 0; i < dayVector.getCount(); ++i)
-            {
-                const WeatherRecord& rec = dayVector[i];
-                collector->all_S.Insert(rec.GetWindSpeed(), collector->all_S.getCount());
-                collector->all_T.Insert(rec.GetTemperature(), collector->all_T.getCount());
-                collector->all_R.Insert(rec.GetSolarRadiation(), collector->all_R.getCount());
-            }
+            collector.all_S.PushBack(speeds[i]);
+            collector.all_T.PushBack(temperatures[i]);
+            collector.all_R.PushBack(radiations[i]);
         }
     }
 }
@@ -187,22 +160,21 @@ void Menu::ProcessMenuChoice(int choice, const WeatherRecords& weatherRecords)
 void Menu::displayAverageWindSpeedAndStdev(int month, int year, const WeatherRecords& weatherRecords) const
 {
     // Query the database
-    const DayMap* monthData = weatherRecords.GetMonthData(year, month);
-
-    // Aggregate all records for that month
-    Vector<WeatherRecord> filtered = AggregateMonthRecords(monthData);
+    const MonthColumns* monthData = weatherRecords.GetMonthData(year, month);
 
     cout << monthNames[month] << " " << year << ": ";
 
-    if (filtered.getCount() == 0)
+    if (monthData == nullptr || monthData->isEmpty())
     {
         cout << "No Data" << endl;
         return;
     }
 
-    // Calculate stats
-    double avgSpeed = Statistics::CalculateAverage(filtered, "S");
-    double stDevSpeed = Statistics::CalculateStandardDeviation(filtered, avgSpeed, "S");
+    // Calculate stats straight from the month's wind speed column
+    const float* speeds = monthData->GetColumn(Sensor::S);
+    int count = monthData->getCount();
+    double avgSpeed = Statistics::CalculateAverage(speeds, count);
+    double stDevSpeed = Statistics::CalculateStandardDeviation(speeds, count, avgSpeed);
 
     cout << "Average speed: " << fixed << setprecision(2) << avgSpeed << " km/h ";
     cout << "Sample stdev: " << fixed << setprecision(2) << stDevSpeed << endl;
@@ -216,22 +188,21 @@ void Menu::displayMonthlyTemperatureAveragesAndStdev(int year, const WeatherReco
     for (int month = 1; month <= 12; ++month)
     {
         // Query DB for this month (FAST)
-        const DayMap* monthData = weatherRecords.GetMonthData(year, month);
-
-        // Aggregate
-        Vector<WeatherRecord> filtered = AggregateMonthRecords(monthData);
+        const MonthColumns* monthData = weatherRecords.GetMonthData(year, month);
 
         cout << monthNames[month] << ": ";
 
-        if (filtered.getCount() == 0)
+        if (monthData == nullptr || monthData->isEmpty())
         {
             cout << "No Data" << endl;
             continue;
         }
 
-        // Calculate stats
-        double avgTemp = Statistics::CalculateAverage(filtered, "T");
-        double stDevTemp = Statistics::CalculateStandardDeviation(filtered, avgTemp, "T");
+        // Calculate stats from the temperature column
+        const float* temperatures = monthData->GetColumn(Sensor::T);
+        int count = monthData->getCount();
+        double avgTemp = Statistics::CalculateAverage(temperatures, count);
+        double stDevTemp = Statistics::CalculateStandardDeviation(temperatures, count, avgTemp);
 
         cout << "average: "
              << fixed << setprecision(2) << avgTemp << " degrees C, "
@@ -246,9 +217,8 @@ void Menu::displaySPCC(int month, const WeatherRecords& weatherRecords) const
     SPCC_Collector collector;
     collector.targetMonth = month;
 
-    // Run the traversal
-    WeatherDatabase& nonConstDB = const_cast<WeatherDatabase&>(weatherRecords);
-    nonConstDB.TraverseYears(sPCC_Visit_Func, &collector);
+    // Run the traversal (const, and the lambda is inlined into it)
+    weatherRecords.TraverseYears([&collector](const YearData& yearData) { collectSPCC(yearData, collector); });
 
     cout << "\nSample Pearson Correlation Coefficient for " << monthNames[month] << endl;
 
@@ -283,37 +253,36 @@ void Menu::outputMonthlyWindTempSolarSummary(int year, const WeatherRecords& wea
 
     bool hasAnyMonthlyData = false;
 
-    // 2. Iterate through months
-    for (int month = 1; month <= 12; ++month)
+    // 2. Iterate through the months stored for this year (one year lookup, months in order)
+    for (const MonthData& monthNode : weatherRecords.GetMonths(year, 1, 12))
     {
-        const DayMap* monthData = weatherRecords.GetMonthData(year, month);
+        int month = monthNode.month;
+        const MonthColumns* monthData = &monthNode.columns;
 
         // If no data for this month, strictly skip it (as per "No output for March")
-        if (monthData == nullptr || monthData->empty()) {
-            continue;
-        }
-
-        Vector<WeatherRecord> filtered = AggregateMonthRecords(monthData);
-        if (filtered.getCount() == 0) {
+        if (monthData->isEmpty()) {
             continue;
         }
 
         hasAnyMonthlyData = true;
 
         // --- Calculate Stats ---
+        int count = monthData->getCount();
 
         // Wind Speed (S)
-        double avgS = Statistics::CalculateAverage(filtered, WIND_SPEED_COLUMN);
-        double sdS  = Statistics::CalculateStandardDeviation(filtered, avgS, WIND_SPEED_COLUMN);
-        double madS = Statistics::CalculateMAD(filtered, avgS, WIND_SPEED_COLUMN);
+        const float* speeds = monthData->GetColumn(Sensor::S);
+        double avgS = Statistics::CalculateAverage(speeds, count);
+        double sdS  = Statistics::CalculateStandardDeviation(speeds, count, avgS);
+        double madS = Statistics::CalculateMAD(speeds, count, avgS);
 
         // Ambient Temp (T)
-        double avgT = Statistics::CalculateAverage(filtered, AIR_TEMP_COLUMN);
-        double sdT  = Statistics::CalculateStandardDeviation(filtered, avgT, AIR_TEMP_COLUMN);
-        double madT = Statistics::CalculateMAD(filtered, avgT, AIR_TEMP_COLUMN);
+        const float* temperatures = monthData->GetColumn(Sensor::T);
+        double avgT = Statistics::CalculateAverage(temperatures, count);
+        double sdT  = Statistics::CalculateStandardDeviation(temperatures, count, avgT);
+        double madT = Statistics::CalculateMAD(temperatures, count, avgT);
 
         // Solar Radiation (SR)
-        double totalSR = Statistics::CalculateTotal(filtered, SOLAR_RAD_COLUMN);
+        double totalSR = Statistics::CalculateTotal(monthData->GetColumn(Sensor::SR), count);
 
         // --- Output Formatting ---
         outputFile << monthNames[month] << ",";
@@ -348,3 +317,51 @@ void Menu::outputMonthlyWindTempSolarSummary(int year, const WeatherRecords& wea
     outputFile.close();
 }
 
+void Menu::DisplaySensorAverages(const SensorFrame& frame) const
+{
+    const SensorSchema& schema = frame.GetSchema();
+    int sensorCount = schema.GetCount();
+
+    // Group rows by year * 100 + month; each entry holds a row count and one sum per sensor
+    std::map<int, Vector<double>> monthSums;
+    for (int row = 0; row < frame.getCount(); ++row)
+    {
+        const Date& date = frame.GetDate(row);
+        int key = date.GetYear() * 100 + date.GetMonth();
+        std::map<int, Vector<double>>::iterator it = monthSums.find(key);
+        if (it == monthSums.end())
+        {
+            it = monthSums.insert(std::make_pair(key, Vector<double>(sensorCount + 1))).first;
+            for (int i = 0; i <= sensorCount; ++i)
+            {
+                it->second.PushBack(0.0);
+            }
+        }
+
+        Vector<double>& sums = it->second;
+        sums[0] += 1.0;
+        for (int slot = 0; slot < sensorCount; ++slot)
+        {
+            sums[slot + 1] += frame.GetColumn(schema.GetSensor(slot))[row];
+        }
+    }
+
+    if (monthSums.empty())
+    {
+        cout << "No sensor data loaded." << endl;
+        return;
+    }
+
+    cout << "Monthly sensor averages" << endl;
+    for (std::map<int, Vector<double>>::const_iterator it = monthSums.begin(); it != monthSums.end(); ++it)
+    {
+        const Vector<double>& sums = it->second;
+        cout << monthNames[it->first % 100] << " " << it->first / 100 << ":";
+        for (int slot = 0; slot < sensorCount; ++slot)
+        {
+            cout << " " << SensorSchema::GetName(schema.GetSensor(slot)) << " "
+                 << fixed << setprecision(2) << sums[slot + 1] / sums[0];
+        }
+        cout << endl;
+    }
+}
@@ -4,6 +4,7 @@
 #include <string>
 #include <iostream>
 #include "Types.h"
+#include "SensorFrame.h"
 
 
 using std::string;
@@ -22,6 +23,11 @@ public:
      * @param weatherRecords The complete set of all loaded weather records.
      */
     void ProcessMenuChoice(int choice, const WeatherDatabase& weatherRecords);
+    /**
+     * @brief Prints the average of every loaded sensor column for each month in the frame.
+     * @param frame Rows loaded through a SensorSchema (e.g. "RH,QFE").
+     */
+    void DisplaySensorAverages(const SensorFrame& frame) const;
 private:
     // Menu 1: Average wind speed and sample standard deviation (specific month and year)
     void displayAverageWindSpeedAndStdev(int month, int year, const WeatherDatabase& weatherRecords) const;
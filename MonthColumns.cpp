@@ -0,0 +1,213 @@
+#include "MonthColumns.h"
+#include <stdexcept>
+
+// Bucket after the 32 regular days (0-31), holding rows whose timestamp does not fit the packing
+static const int IRREGULAR_BUCKET = MONTH_DAY_BUCKETS - 1;
+static const uint32_t SECONDS_PER_DAY = 86400;
+
+MonthColumns::MonthColumns()
+    : m_year(0), m_month(0), m_timestamps(), m_windSpeeds(), m_temperatures(), m_solarRadiations(), m_irregular()
+{
+    for (int i = 0; i <= MONTH_DAY_BUCKETS; ++i)
+    {
+        m_bucketStart[i] = 0;
+    }
+}
+
+MonthColumns::MonthColumns(int year, int month, Arena* arena)
+    : m_year(year), m_month(month),
+      m_timestamps(ArenaAllocator<uint32_t>(arena)),
+      m_windSpeeds(ArenaAllocator<float>(arena)),
+      m_temperatures(ArenaAllocator<float>(arena)),
+      m_solarRadiations(ArenaAllocator<float>(arena)),
+      m_irregular(ArenaAllocator<IrregularStamp>(arena))
+{
+    for (int i = 0; i <= MONTH_DAY_BUCKETS; ++i)
+    {
+        m_bucketStart[i] = 0;
+    }
+}
+
+// Seconds since the start of the month; false if a part is outside its usual range
+static bool packTimestamp(const WeatherRecord& record, uint32_t& stamp)
+{
+    int day = record.GetDate().GetDay();
+    const Time& time = record.GetTime();
+    if (day < 0 || day > 31 || time.GetHour() < 0 || time.GetHour() > 23 || time.GetMinute() < 0
+            || time.GetMinute() > 59 || time.GetSecond() < 0 || time.GetSecond() > 59)
+    {
+        return false;
+    }
+    stamp = static_cast<uint32_t>(((day * 24 + time.GetHour()) * 60 + time.GetMinute()) * 60 + time.GetSecond());
+    return true;
+}
+
+int MonthColumns::bucketOf(const WeatherRecord& record, uint32_t& stamp)
+{
+    if (packTimestamp(record, stamp))
+    {
+        return record.GetDate().GetDay();
+    }
+
+    stamp = static_cast<uint32_t>(m_irregular.getCount());
+    m_irregular.PushBack(IrregularStamp{record.GetDate().GetDay(), record.GetTime()});
+    return IRREGULAR_BUCKET;
+}
+
+void MonthColumns::Append(const WeatherRecord& record)
+{
+    uint32_t stamp;
+    int bucket = bucketOf(record, stamp);
+    int row = m_bucketStart[bucket + 1];
+
+    if (row == getCount())
+    {
+        // Records usually arrive in time order, so this is the common case
+        m_timestamps.PushBack(stamp);
+        m_windSpeeds.PushBack(record.GetWindSpeed());
+        m_temperatures.PushBack(record.GetTemperature());
+        m_solarRadiations.PushBack(record.GetSolarRadiation());
+    }
+    else
+    {
+        m_timestamps.Insert(stamp, row);
+        m_windSpeeds.Insert(record.GetWindSpeed(), row);
+        m_temperatures.Insert(record.GetTemperature(), row);
+        m_solarRadiations.Insert(record.GetSolarRadiation(), row);
+    }
+
+    for (int i = bucket + 1; i <= MONTH_DAY_BUCKETS; ++i)
+    {
+        m_bucketStart[i]++;
+    }
+}
+
+bool MonthColumns::sameMinute(int row, const Time& time) const
+{
+    if (row >= m_bucketStart[IRREGULAR_BUCKET])
+    {
+        const Time& stored = m_irregular[static_cast<int>(m_timestamps[row])].time;
+        return stored.GetHour() == time.GetHour() && stored.GetMinute() == time.GetMinute();
+    }
+    uint32_t minuteOfDay = m_timestamps[row] % SECONDS_PER_DAY / 60;
+    return static_cast<int>(minuteOfDay) == time.GetHour() * 60 + time.GetMinute();
+}
+
+void MonthColumns::setRow(int row, uint32_t stamp, const WeatherRecord& record)
+{
+    m_timestamps[row] = stamp;
+    m_windSpeeds[row] = record.GetWindSpeed();
+    m_temperatures[row] = record.GetTemperature();
+    m_solarRadiations[row] = record.GetSolarRadiation();
+}
+
+bool MonthColumns::Replace(const WeatherRecord& record)
+{
+    int day = record.GetDate().GetDay();
+    const Time& time = record.GetTime();
+    uint32_t stamp = 0;
+    bool regular = packTimestamp(record, stamp);
+    int bucket = regular ? day : IRREGULAR_BUCKET;
+
+    for (int row = m_bucketStart[bucket + 1] - 1; row >= m_bucketStart[bucket]; --row)
+    {
+        bool sameDay = regular || m_irregular[static_cast<int>(m_timestamps[row])].day == day;
+        if (sameDay && sameMinute(row, time))
+        {
+            if (!regular)
+            {
+                // The row keeps its side table entry
+                stamp = m_timestamps[row];
+                m_irregular[static_cast<int>(stamp)].time = time;
+            }
+            setRow(row, stamp, record);
+            return true;
+        }
+    }
+    return false;
+}
+
+int MonthColumns::getCount() const
+{
+    return m_timestamps.getCount();
+}
+
+bool MonthColumns::isEmpty() const
+{
+    return getCount() == 0;
+}
+
+int MonthColumns::GetDayBegin(int day) const
+{
+    if (day < 0 || day >= IRREGULAR_BUCKET)
+    {
+        throw std::out_of_range("MonthColumns day out of range.");
+    }
+    return m_bucketStart[day];
+}
+
+int MonthColumns::GetDayEnd(int day) const
+{
+    if (day < 0 || day >= IRREGULAR_BUCKET)
+    {
+        throw std::out_of_range("MonthColumns day out of range.");
+    }
+    return m_bucketStart[day + 1];
+}
+
+bool MonthColumns::HasColumn(Sensor sensor) const
+{
+    return sensor == Sensor::S || sensor == Sensor::T || sensor == Sensor::SR;
+}
+
+const float* MonthColumns::GetColumn(Sensor sensor) const
+{
+    const Vector<float, ArenaAllocator<float>>* column;
+    switch (sensor)
+    {
+    case Sensor::S:
+        column = &m_windSpeeds;
+        break;
+    case Sensor::T:
+        column = &m_temperatures;
+        break;
+    case Sensor::SR:
+        column = &m_solarRadiations;
+        break;
+    default:
+        throw std::out_of_range("MonthColumns does not store this sensor.");
+    }
+    return isEmpty() ? nullptr : &(*column)[0];
+}
+
+bool MonthColumns::HasIrregularTimestamps() const
+{
+    return m_bucketStart[IRREGULAR_BUCKET] != getCount();
+}
+
+const uint32_t* MonthColumns::GetTimestamps() const
+{
+    return isEmpty() ? nullptr : &m_timestamps[0];
+}
+
+WeatherRecord MonthColumns::GetRecord(int row) const
+{
+    uint32_t stamp = m_timestamps[row];
+    WeatherRecord record;
+    if (row >= m_bucketStart[IRREGULAR_BUCKET])
+    {
+        const IrregularStamp& irregular = m_irregular[static_cast<int>(stamp)];
+        record.SetDate(Date(irregular.day, m_month, m_year));
+        record.SetTime(irregular.time);
+    }
+    else
+    {
+        record.SetDate(Date(static_cast<int>(stamp / SECONDS_PER_DAY), m_month, m_year));
+        record.SetTime(Time(static_cast<int>(stamp / 3600 % 24), static_cast<int>(stamp / 60 % 60),
+                            static_cast<int>(stamp % 60)));
+    }
+    record.SetWindSpeed(m_windSpeeds[row]);
+    record.SetTemperature(m_temperatures[row]);
+    record.SetSolarRadiation(m_solarRadiations[row]);
+    return record;
+}
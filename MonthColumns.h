@@ -0,0 +1,160 @@
+#ifndef MONTHCOLUMNS_H_INCLUDED
+#define MONTHCOLUMNS_H_INCLUDED
+
+#include "Arena.h"
+#include "SensorSchema.h"
+#include "Vector.h"
+#include "WeatherRecord.h"
+#include <cstdint>
+
+/// @brief Day buckets of a month: days 0-31, then one for timestamps outside the usual ranges.
+const int MONTH_DAY_BUCKETS = 33;
+
+/**
+ * @class MonthColumns
+ * @brief Columnar storage for the records of one month.
+ *
+ * Each sensor has one contiguous float array for the whole month, so a
+ * statistic over one sensor streams 4 bytes per record instead of whole
+ * records. Timestamps are a compact column of seconds since the start of the
+ * month (the packing the record cache uses). Rows are grouped by day, days in
+ * ascending order and records of a day in insertion order; a table of day
+ * offsets gives each day's rows, replacing a per-day map of record vectors.
+ *
+ * Appending to the latest day is amortised O(1); a record for an earlier day
+ * shifts the rows of the later days. Timestamps that do not fit the packing
+ * (day outside 0-31, hour, minute or second out of range) are kept exactly in
+ * a side table and their rows are stored after every regular day.
+ */
+class MonthColumns
+{
+public:
+    /**
+     * @brief Creates an empty month with no year or month set, using the heap.
+     */
+    MonthColumns();
+
+    /**
+     * @brief Creates an empty month whose columns come from an arena.
+     * @param year The year of the records.
+     * @param month The month of the records.
+     * @param arena The arena (nullptr: use the heap).
+     */
+    MonthColumns(int year, int month, Arena* arena);
+
+    /**
+     * @brief Adds a record after the other records of its day.
+     * The record's year and month are not stored; they are those of the MonthColumns.
+     * @param record The record.
+     */
+    void Append(const WeatherRecord& record);
+
+    /**
+     * @brief Overwrites the latest stored record of the same day, hour and minute.
+     * @param record The replacement.
+     * @return false (storing nothing) if no such record is stored.
+     */
+    bool Replace(const WeatherRecord& record);
+
+    /**
+     * @brief Gets the number of records.
+     * @return The row count.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Checks whether the month holds no records.
+     * @return true if it is empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Gets the first row of a day.
+     * @param day The day (0-31).
+     * @return The row index; equal to GetDayEnd(day) if the day has no records.
+     */
+    int GetDayBegin(int day) const;
+
+    /**
+     * @brief Gets the row after the last row of a day.
+     * @param day The day (0-31).
+     * @return The row index.
+     */
+    int GetDayEnd(int day) const;
+
+    /**
+     * @brief Checks whether a sensor is stored.
+     * @param sensor The sensor.
+     * @return true for Sensor::S, Sensor::T and Sensor::SR.
+     */
+    bool HasColumn(Sensor sensor) const;
+
+    /**
+     * @brief Gets the values of one sensor, one per row.
+     * @param sensor The sensor; must be Sensor::S, Sensor::T or Sensor::SR.
+     * @return getCount() values (nullptr if the month is empty).
+     * @throws std::out_of_range if the sensor is not stored.
+     */
+    const float* GetColumn(Sensor sensor) const;
+
+    /**
+     * @brief Checks whether any record has a timestamp outside the packed ranges.
+     * @return true if some rows are kept in the side table.
+     */
+    bool HasIrregularTimestamps() const;
+
+    /**
+     * @brief Gets the timestamp column: seconds since the start of the month ((day * 24 + hour) * 60 + minute) * 60 + second.
+     * Only meaningful when HasIrregularTimestamps() is false.
+     * @return getCount() timestamps (nullptr if the month is empty).
+     */
+    const uint32_t* GetTimestamps() const;
+
+    /**
+     * @brief Rebuilds the record stored in a row.
+     * @param row The row index.
+     * @return The record.
+     */
+    WeatherRecord GetRecord(int row) const;
+
+    /**
+     * @brief Calls visit(record) for every record in row order.
+     * @param visit Any callable taking const WeatherRecord&.
+     */
+    template <class Visitor>
+    void ForEachRecord(Visitor&& visit) const
+    {
+        for (int row = 0; row < getCount(); ++row)
+        {
+            visit(GetRecord(row));
+        }
+    }
+
+private:
+    /// @brief Exact date and time of a row whose timestamp does not fit the packing.
+    struct IrregularStamp
+    {
+        int day;
+        Time time;
+    };
+
+    int m_year;                                          //!< Year of every record.
+    int m_month;                                         //!< Month of every record.
+    int m_bucketStart[MONTH_DAY_BUCKETS + 1];            //!< First row of each day bucket; the last entry is the row count.
+    Vector<uint32_t, ArenaAllocator<uint32_t>> m_timestamps; //!< Packed timestamp, or side table index for irregular rows.
+    Vector<float, ArenaAllocator<float>> m_windSpeeds;       //!< Sensor::S column.
+    Vector<float, ArenaAllocator<float>> m_temperatures;     //!< Sensor::T column.
+    Vector<float, ArenaAllocator<float>> m_solarRadiations;  //!< Sensor::SR column.
+    Vector<IrregularStamp, ArenaAllocator<IrregularStamp>> m_irregular; //!< Timestamps of irregular rows.
+
+    /// @brief Gets the bucket of a record and its timestamp column value (adding irregular ones to the side table).
+    int bucketOf(const WeatherRecord& record, uint32_t& stamp);
+
+    /// @brief Checks whether a stored row has the given hour and minute.
+    bool sameMinute(int row, const Time& time) const;
+
+    /// @brief Stores the values of a record in an existing row.
+    void setRow(int row, uint32_t stamp, const WeatherRecord& record);
+};
+
+#endif // MONTHCOLUMNS_H_INCLUDED
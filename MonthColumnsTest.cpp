@@ -0,0 +1,113 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "Arena.h"
+#include "MonthColumns.h"
+
+using namespace std;
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static WeatherRecord makeRecord(int day, int hour, int minute, float speed)
+{
+    WeatherRecord record;
+    record.SetDate(Date(day, 3, 2010));
+    record.SetTime(Time(hour, minute, 0));
+    record.SetWindSpeed(speed);
+    record.SetTemperature(speed + 20.0f);
+    record.SetSolarRadiation(speed * 100.0f);
+    return record;
+}
+
+static bool sameRecord(const WeatherRecord& a, const WeatherRecord& b)
+{
+    return a.GetDate().GetDay() == b.GetDate().GetDay() && a.GetDate().GetMonth() == b.GetDate().GetMonth()
+           && a.GetDate().GetYear() == b.GetDate().GetYear() && a.GetTime().GetHour() == b.GetTime().GetHour()
+           && a.GetTime().GetMinute() == b.GetTime().GetMinute() && a.GetTime().GetSecond() == b.GetTime().GetSecond()
+           && a.GetWindSpeed() == b.GetWindSpeed() && a.GetTemperature() == b.GetTemperature()
+           && a.GetSolarRadiation() == b.GetSolarRadiation();
+}
+
+int main()
+{
+    cout << "--- MonthColumns Unit Tests ---" << endl;
+
+    // 1. Records of an earlier day are placed before the later days, each day keeping insertion order
+    cout << "\n--- Day Order Test ---" << endl;
+    Arena arena;
+    MonthColumns month(2010, 3, &arena);
+    bool startedEmpty = month.isEmpty() && month.GetColumn(Sensor::S) == nullptr;
+    month.Append(makeRecord(5, 9, 0, 1.0f));
+    month.Append(makeRecord(5, 9, 10, 2.0f));
+    month.Append(makeRecord(2, 9, 0, 3.0f));
+    month.Append(makeRecord(31, 0, 0, 4.0f));
+    month.Append(makeRecord(2, 8, 0, 5.0f));
+    const float* speeds = month.GetColumn(Sensor::S);
+    const float* temperatures = month.GetColumn(Sensor::T);
+    bool orderOk = month.getCount() == 5 && speeds[0] == 3.0f && speeds[1] == 5.0f && speeds[2] == 1.0f
+                   && speeds[3] == 2.0f && speeds[4] == 4.0f && temperatures[1] == 25.0f;
+    report("Day Order Test", startedEmpty && orderOk && arena.GetBlockCount() == 1);
+
+    // 2. Day offsets give each day's rows
+    cout << "\n--- Day Offset Test ---" << endl;
+    bool offsetsOk = month.GetDayBegin(0) == 0 && month.GetDayEnd(1) == 0 && month.GetDayBegin(2) == 0
+                     && month.GetDayEnd(2) == 2 && month.GetDayBegin(5) == 2 && month.GetDayEnd(5) == 4
+                     && month.GetDayBegin(6) == 4 && month.GetDayBegin(31) == 4 && month.GetDayEnd(31) == 5;
+    const uint32_t* stamps = month.GetTimestamps();
+    bool stampsOk = stamps[0] == (2 * 24 + 9) * 3600 && stamps[3] == (5 * 24 + 9) * 3600 + 600;
+    bool dayThrew = false;
+    try
+    {
+        month.GetDayBegin(32);
+    }
+    catch (const out_of_range&)
+    {
+        dayThrew = true;
+    }
+    report("Day Offset Test", offsetsOk && stampsOk && dayThrew
+           && sameRecord(month.GetRecord(3), makeRecord(5, 9, 10, 2.0f)));
+
+    // 3. Replace overwrites the record of the same day and minute only
+    cout << "\n--- Replace Test ---" << endl;
+    bool replaced = month.Replace(makeRecord(5, 9, 10, 7.0f));
+    bool notFound = !month.Replace(makeRecord(6, 9, 10, 8.0f));
+    report("Replace Test", replaced && notFound && month.getCount() == 5 && month.GetColumn(Sensor::S)[3] == 7.0f
+           && month.GetColumn(Sensor::SR)[3] == 700.0f);
+
+    // 4. Timestamps outside the packed ranges come back exactly, after the regular days
+    cout << "\n--- Irregular Timestamp Test ---" << endl;
+    MonthColumns irregular;
+    irregular.Append(makeRecord(3, 10, 0, 1.0f));
+    irregular.Append(makeRecord(40, 10, 0, 2.0f));
+    irregular.Append(makeRecord(4, 25, 70, 3.0f));
+    irregular.Append(makeRecord(1, 0, 0, 4.0f));
+    bool irregularReplaced = irregular.Replace(makeRecord(4, 25, 70, 9.0f));
+    int visited = 0;
+    irregular.ForEachRecord([&visited](const WeatherRecord&) { visited++; });
+    const float* irregularSpeeds = irregular.GetColumn(Sensor::S);
+    bool irregularOk = irregular.HasIrregularTimestamps() && !month.HasIrregularTimestamps() && visited == 4
+                       && irregularSpeeds[0] == 4.0f && irregularSpeeds[1] == 1.0f && irregularSpeeds[3] == 9.0f
+                       && irregular.GetRecord(2).GetDate().GetDay() == 40
+                       && irregular.GetRecord(3).GetTime().GetHour() == 25
+                       && irregular.GetRecord(3).GetTime().GetMinute() == 70;
+    report("Irregular Timestamp Test", irregularOk && irregularReplaced);
+
+    // 5. Only the stored sensors have columns
+    cout << "\n--- Column Test ---" << endl;
+    bool columnThrew = false;
+    try
+    {
+        month.GetColumn(Sensor::RH);
+    }
+    catch (const out_of_range&)
+    {
+        columnThrew = true;
+    }
+    report("Column Test", columnThrew && month.HasColumn(Sensor::T) && !month.HasColumn(Sensor::RH));
+
+    cout << "\n--- End of MonthColumns Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,421 @@
+#include "RecordCache.h"
+#include "RecordSink.h"
+#include "Types.h"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <sys/stat.h>
+
+using std::ifstream;
+using std::ofstream;
+using std::cerr;
+using std::endl;
+
+const char CACHE_MAGIC[8] = { 'W', 'X', 'C', 'A', 'C', 'H', 'E', '1' };
+const uint32_t CACHE_VERSION = 2; // 2: the header holds the dropped duplicate count
+
+// Size stored for a listed file that did not exist when the cache was written
+const uint64_t MISSING_FILE_SIZE = UINT64_MAX;
+
+/**
+ * @brief Fixed-size start of the cache file.
+ */
+struct CacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t sourceCount;
+    uint32_t monthCount;
+    uint32_t duplicatePolicy; // DuplicatePolicy the database was loaded with
+    uint64_t recordCount;
+    uint64_t droppedCount;    // Duplicates dropped or replaced before the database was saved
+};
+
+/**
+ * @brief Metadata of one source file; followed by nameLength bytes of name, padded to 8.
+ */
+struct SourceEntry
+{
+    uint64_t size;
+    int64_t mtime;
+    uint32_t nameLength;
+    uint32_t mtimeNanoseconds;
+};
+
+/**
+ * @brief Directory entry for the columns of one month.
+ */
+struct MonthEntry
+{
+    int32_t year;
+    int32_t month;
+    uint32_t recordCount;
+    uint32_t reserved;
+    uint64_t offset;
+};
+
+static_assert(sizeof(CacheHeader) == 40, "CacheHeader must be packed to 40 bytes");
+static_assert(sizeof(SourceEntry) == 24, "SourceEntry must be packed to 24 bytes");
+static_assert(sizeof(MonthEntry) == 24, "MonthEntry must be packed to 24 bytes");
+
+// Rounds a byte count up to the 8-byte section alignment
+static uint64_t align8(uint64_t n)
+{
+    return (n + 7) & ~static_cast<uint64_t>(7);
+}
+
+// Sub-second part of a file's modification time, so an edit within the same second is noticed
+static uint32_t mtimeNanoseconds(const struct stat& info)
+{
+#if defined(_WIN32)
+    (void)info;
+    return 0; // The C runtime's stat only has whole seconds
+#elif defined(__APPLE__)
+    return static_cast<uint32_t>(info.st_mtimespec.tv_nsec);
+#else
+    return static_cast<uint32_t>(info.st_mtim.tv_nsec);
+#endif
+}
+
+// Fills the size/mtime of a file; missing files get MISSING_FILE_SIZE
+static void stampFile(const string& path, SourceEntry& entry)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) == 0)
+    {
+        entry.size = static_cast<uint64_t>(info.st_size);
+        entry.mtime = static_cast<int64_t>(info.st_mtime);
+        entry.mtimeNanoseconds = mtimeNanoseconds(info);
+    }
+    else
+    {
+        entry.size = MISSING_FILE_SIZE;
+        entry.mtime = 0;
+        entry.mtimeNanoseconds = 0;
+    }
+}
+
+/**
+ * @brief Traversal context used while writing the cache.
+ */
+struct CacheWriter
+{
+    Vector<MonthEntry> months; // Directory, filled by the first pass
+    ofstream* out = nullptr;   // Column output, used by the second pass
+    uint64_t recordCount = 0;
+    int currentYear = 0;
+    bool packable = true;      // False if a timestamp does not fit the packed column
+};
+
+// Pass 1: directory entry for every month
+static void collectMonthVisit(MonthData& monthData, void* userData)
+{
+    CacheWriter* writer = static_cast<CacheWriter*>(userData);
+
+    MonthEntry entry;
+    entry.year = writer->currentYear;
+    entry.month = monthData.month;
+    entry.recordCount = static_cast<uint32_t>(monthData.columns.getCount());
+    entry.reserved = 0;
+    entry.offset = 0;
+    if (monthData.columns.HasIrregularTimestamps())
+    {
+        writer->packable = false;
+    }
+
+    writer->recordCount += entry.recordCount;
+    writer->months.PushBack(entry);
+}
+
+static void collectYearVisit(YearData& yearData, void* userData)
+{
+    static_cast<CacheWriter*>(userData)->currentYear = yearData.year;
+    yearData.monthTree.InOrder(collectMonthVisit, userData);
+}
+
+// Pass 2: the four columns of every month
+static void writeMonthVisit(MonthData& monthData, void* userData)
+{
+    CacheWriter* writer = static_cast<CacheWriter*>(userData);
+    const MonthColumns& columns = monthData.columns;
+
+    int count = columns.getCount();
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t columnBytes = static_cast<size_t>(count) * 4;
+    writer->out->write(reinterpret_cast<const char*>(columns.GetTimestamps()), columnBytes);
+    writer->out->write(reinterpret_cast<const char*>(columns.GetColumn(Sensor::S)), columnBytes);
+    writer->out->write(reinterpret_cast<const char*>(columns.GetColumn(Sensor::T)), columnBytes);
+    writer->out->write(reinterpret_cast<const char*>(columns.GetColumn(Sensor::SR)), columnBytes);
+
+    // Keep the next month's columns 8-byte aligned
+    static const char padding[8] = {0};
+    uint64_t written = static_cast<uint64_t>(columnBytes) * 4;
+    writer->out->write(padding, static_cast<std::streamsize>(align8(written) - written));
+}
+
+static void writeYearVisit(YearData& yearData, void* userData)
+{
+    yearData.monthTree.InOrder(writeMonthVisit, userData);
+}
+
+bool RecordCache::Save(WeatherDatabase& weatherRecords, const string& cacheFilename, const string& sourceFilename)
+{
+    // --- 1. Stamp the source list and every file it names ---
+    ifstream sourceFile(sourceFilename);
+    if (!sourceFile.is_open())
+    {
+        cerr << "Warning: Could not write cache file " << cacheFilename << ": cannot read " << sourceFilename << endl;
+        return false;
+    }
+
+    Vector<string> names;
+    names.Insert(sourceFilename, 0);
+    string filename;
+    while (getline(sourceFile, filename))
+    {
+        names.PushBack(filename);
+    }
+    sourceFile.close();
+
+    // --- 2. Build the month directory ---
+    CacheWriter writer;
+    weatherRecords.TraverseYears(collectYearVisit, &writer);
+    if (!writer.packable)
+    {
+        cerr << "Warning: Not writing cache file " << cacheFilename
+             << ": some records have a day or time outside the cached range, so the CSVs are parsed on every start" << endl;
+        return false;
+    }
+
+    uint64_t offset = sizeof(CacheHeader);
+    for (int i = 0; i < names.getCount(); ++i)
+    {
+        offset += sizeof(SourceEntry) + align8(names[i].size());
+    }
+    offset += sizeof(MonthEntry) * static_cast<uint64_t>(writer.months.getCount());
+    for (int i = 0; i < writer.months.getCount(); ++i)
+    {
+        writer.months[i].offset = offset;
+        offset += align8(static_cast<uint64_t>(writer.months[i].recordCount) * 16);
+    }
+
+    // --- 3. Write everything to a temporary file, then move it into place ---
+    string tempFilename = cacheFilename + ".tmp";
+    ofstream out(tempFilename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        cerr << "Warning: Could not write cache file " << cacheFilename << ": cannot create " << tempFilename << endl;
+        return false;
+    }
+
+    CacheHeader header;
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.sourceCount = static_cast<uint32_t>(names.getCount());
+    header.monthCount = static_cast<uint32_t>(writer.months.getCount());
+    header.duplicatePolicy = static_cast<uint32_t>(weatherRecords.GetDuplicatePolicy());
+    header.recordCount = writer.recordCount;
+    // Flagged copies are stored and counted again on load; only the dropped ones must be remembered
+    DuplicatePolicy policy = weatherRecords.GetDuplicatePolicy();
+    bool dropsCopies = policy == DuplicatePolicy::FirstWins || policy == DuplicatePolicy::LastWins;
+    header.droppedCount = dropsCopies ? static_cast<uint64_t>(weatherRecords.GetDuplicateCount()) : 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    static const char padding[8] = {0};
+    for (int i = 0; i < names.getCount(); ++i)
+    {
+        SourceEntry entry;
+        stampFile(i == 0 ? names[i] : DATA_FOLDER + names[i], entry);
+        entry.nameLength = static_cast<uint32_t>(names[i].size());
+        out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        out.write(names[i].data(), static_cast<std::streamsize>(names[i].size()));
+        out.write(padding, static_cast<std::streamsize>(align8(names[i].size()) - names[i].size()));
+    }
+
+    for (int i = 0; i < writer.months.getCount(); ++i)
+    {
+        out.write(reinterpret_cast<const char*>(&writer.months[i]), sizeof(MonthEntry));
+    }
+
+    writer.out = &out;
+    weatherRecords.TraverseYears(writeYearVisit, &writer);
+
+    out.close();
+    if (!out)
+    {
+        cerr << "Warning: Could not write cache file " << cacheFilename << ": write to " << tempFilename << " failed" << endl;
+        remove(tempFilename.c_str());
+        return false;
+    }
+
+    remove(cacheFilename.c_str());
+    if (rename(tempFilename.c_str(), cacheFilename.c_str()) != 0)
+    {
+        cerr << "Warning: Could not write cache file " << cacheFilename << ": cannot rename " << tempFilename << endl;
+        return false;
+    }
+    return true;
+}
+
+int RecordCache::Load(WeatherDatabase& weatherRecords, const string& cacheFilename, const string& sourceFilename)
+{
+    CacheRecordSource source(cacheFilename, sourceFilename);
+    if (!source.IsOpen() || source.GetDuplicatePolicy() != weatherRecords.GetDuplicatePolicy())
+    {
+        return -1;
+    }
+
+    DatabaseSink sink(weatherRecords);
+    int recordsLoaded = static_cast<int>(PumpRecords(source, sink));
+    weatherRecords.AddDroppedDuplicates(static_cast<long>(source.GetDroppedCount()));
+    weatherRecords.FinishLoading();
+    return recordsLoaded;
+}
+
+CacheRecordSource::CacheRecordSource(const string& cacheFilename, const string& sourceFilename)
+    : m_file(), m_directory(nullptr), m_monthCount(0), m_month(0), m_index(0),
+      m_duplicatePolicy(DuplicatePolicy::KeepAll), m_droppedCount(0), m_isOpen(false)
+{
+    m_isOpen = open(cacheFilename, sourceFilename);
+}
+
+bool CacheRecordSource::IsOpen() const
+{
+    return m_isOpen;
+}
+
+DuplicatePolicy CacheRecordSource::GetDuplicatePolicy() const
+{
+    return m_duplicatePolicy;
+}
+
+uint64_t CacheRecordSource::GetDroppedCount() const
+{
+    return m_droppedCount;
+}
+
+bool CacheRecordSource::open(const string& cacheFilename, const string& sourceFilename)
+{
+    if (!m_file.Open(cacheFilename))
+    {
+        return false;
+    }
+
+    const char* data = m_file.GetData();
+    uint64_t size = m_file.GetSize();
+
+    // --- 1. Header ---
+    CacheHeader header;
+    if (size < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 || header.version != CACHE_VERSION)
+    {
+        return false;
+    }
+
+    // --- 2. Source stamps: any change in size or mtime makes the cache stale ---
+    uint64_t pos = sizeof(header);
+    for (uint32_t i = 0; i < header.sourceCount; ++i)
+    {
+        SourceEntry stored;
+        if (pos + sizeof(stored) > size)
+        {
+            return false;
+        }
+        memcpy(&stored, data + pos, sizeof(stored));
+        pos += sizeof(stored);
+        if (pos + stored.nameLength > size)
+        {
+            return false;
+        }
+        string name(data + pos, stored.nameLength);
+        pos += align8(stored.nameLength);
+
+        if (i == 0 && name != sourceFilename)
+        {
+            return false;
+        }
+
+        SourceEntry current;
+        stampFile(i == 0 ? name : DATA_FOLDER + name, current);
+        if (current.size != stored.size || current.mtime != stored.mtime
+                || current.mtimeNanoseconds != stored.mtimeNanoseconds)
+        {
+            return false;
+        }
+    }
+
+    // --- 3. Month directory ---
+    if (pos + static_cast<uint64_t>(header.monthCount) * sizeof(MonthEntry) > size)
+    {
+        return false;
+    }
+    const char* directory = data + pos;
+
+    // Check every month before handing out anything, so a corrupt file yields no records
+    for (uint32_t m = 0; m < header.monthCount; ++m)
+    {
+        MonthEntry entry;
+        memcpy(&entry, directory + m * sizeof(MonthEntry), sizeof(entry));
+        if (entry.offset % 8 != 0 || entry.offset + static_cast<uint64_t>(entry.recordCount) * 16 > size)
+        {
+            return false;
+        }
+    }
+
+    m_directory = directory;
+    m_monthCount = header.monthCount;
+    m_duplicatePolicy = static_cast<DuplicatePolicy>(header.duplicatePolicy);
+    m_droppedCount = header.droppedCount;
+    return true;
+}
+
+int CacheRecordSource::NextBatch(WeatherRecord* records, int capacity)
+{
+    if (!m_isOpen)
+    {
+        return -1;
+    }
+
+    const char* data = m_file.GetData();
+    int written = 0;
+    while (written < capacity && m_month < m_monthCount)
+    {
+        MonthEntry entry;
+        memcpy(&entry, m_directory + m_month * sizeof(MonthEntry), sizeof(entry));
+        uint64_t count = entry.recordCount;
+
+        const uint32_t* timestamps = reinterpret_cast<const uint32_t*>(data + entry.offset);
+        const float* windSpeeds = reinterpret_cast<const float*>(timestamps + count);
+        const float* temperatures = windSpeeds + count;
+        const float* solarRadiations = temperatures + count;
+
+        for (; m_index < count && written < capacity; ++m_index)
+        {
+            uint32_t seconds = timestamps[m_index];
+            WeatherRecord& record = records[written++];
+            record.SetDate(Date(static_cast<int>(seconds / 86400), entry.month, entry.year));
+            record.SetTime(Time(static_cast<int>(seconds / 3600 % 24), static_cast<int>(seconds / 60 % 60),
+                                static_cast<int>(seconds % 60)));
+            record.SetWindSpeed(windSpeeds[m_index]);
+            record.SetTemperature(temperatures[m_index]);
+            record.SetSolarRadiation(solarRadiations[m_index]);
+        }
+
+        if (m_index == count)
+        {
+            m_month++;
+            m_index = 0;
+        }
+    }
+    return written;
+}
@@ -0,0 +1,109 @@
+#ifndef RECORDCACHE_H_INCLUDED
+#define RECORDCACHE_H_INCLUDED
+
+#include "WeatherDatabase.h"
+#include "RecordSource.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+
+using std::string;
+
+/**
+ * @class RecordCache
+ * @brief Binary columnar snapshot of a WeatherDatabase for fast startup.
+ *
+ * Layout (native byte order, every section 8-byte aligned):
+ *  - CacheHeader: magic "WXCACHE1", format version, section counts, the
+ *    DuplicatePolicy of the database (a cache only loads under the same policy)
+ *    and how many duplicates that load dropped.
+ *  - One SourceEntry per line of the source list (plus the list itself), holding
+ *    the file's size and modification time (seconds and nanoseconds) followed
+ *    by its name.
+ *  - One MonthEntry per (year, month) with its record count and column offset.
+ *  - For every month, four columns of recordCount values: the timestamp as
+ *    seconds since the start of the month (uint32), then wind speed, temperature
+ *    and solar radiation (float, already unit-converted).
+ *
+ * Months are stored in year/month order and records in day/insertion order, so
+ * loading the cache rebuilds exactly the same database as parsing the CSVs.
+ * The cache is stale as soon as the size or mtime of the source list or of any
+ * listed CSV changes (including a missing file appearing); only file metadata is
+ * checked, the text files are never opened.
+ */
+class RecordCache
+{
+public:
+    /**
+     * @brief Loads a database from a cache file if it is still valid.
+     * @param weatherRecords The container to store the cached records.
+     * @param cacheFilename The cache file path.
+     * @param sourceFilename The source list the cache was built from.
+     * The duplicates dropped when the cache was written are added to the database's duplicate count.
+     * @return The number of records loaded, or -1 if the cache is missing, stale or corrupt.
+     */
+    static int Load(WeatherDatabase& weatherRecords, const string& cacheFilename, const string& sourceFilename);
+
+    /**
+     * @brief Writes a database to a cache file, stamped with the current source file metadata.
+     * The file is written under a temporary name and renamed into place. If it cannot
+     * be written the reason is printed on cerr as a one-line warning.
+     * Records whose day or time does not fit the packed timestamp column are not cached.
+     * @param weatherRecords The loaded database.
+     * @param cacheFilename The cache file path.
+     * @param sourceFilename The source list the database was loaded from.
+     * @return true if the cache was written.
+     */
+    static bool Save(WeatherDatabase& weatherRecords, const string& cacheFilename, const string& sourceFilename);
+};
+
+/**
+ * @class CacheRecordSource
+ * @brief Streams the records of a RecordCache file straight from the mapping,
+ * in the same year/month/day order RecordCache::Save wrote them.
+ */
+class CacheRecordSource : public RecordSource
+{
+public:
+    /**
+     * @brief Maps the cache and validates it against the current source files.
+     * A missing, stale or corrupt cache leaves the source closed.
+     * @param cacheFilename The cache file path.
+     * @param sourceFilename The source list the cache was built from.
+     */
+    CacheRecordSource(const string& cacheFilename, const string& sourceFilename);
+
+    /**
+     * @brief Checks that the cache is valid and can be read.
+     * @return true if records can be read.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets the duplicate policy the cached database was loaded with.
+     * @return The stored DuplicatePolicy.
+     */
+    DuplicatePolicy GetDuplicatePolicy() const;
+
+    /**
+     * @brief Gets the number of duplicates dropped before the database was saved.
+     * @return The dropped count (0 with KeepAll or Flag, whose copies are all stored).
+     */
+    uint64_t GetDroppedCount() const;
+
+    int NextBatch(WeatherRecord* records, int capacity) override;
+
+private:
+    bool open(const string& cacheFilename, const string& sourceFilename);
+
+    MappedFile m_file;                 //!< The mapped cache file.
+    const char* m_directory;           //!< First month directory entry.
+    uint32_t m_monthCount;             //!< Number of directory entries.
+    uint32_t m_month;                  //!< Month currently being read.
+    uint64_t m_index;                  //!< Next record within that month.
+    DuplicatePolicy m_duplicatePolicy; //!< Policy stored in the header.
+    uint64_t m_droppedCount;           //!< Dropped duplicates stored in the header.
+    bool m_isOpen;                     //!< True once the whole file was validated.
+};
+
+#endif // RECORDCACHE_H_INCLUDED
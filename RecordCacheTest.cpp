@@ -0,0 +1,180 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
+#include "RecordCache.h"
+#include "Types.h"
+
+using namespace std;
+
+// Run from the project folder: listed files are looked up in DATA_FOLDER
+const char* SOURCE_LIST = "cache_test_sources.txt";
+const char* CACHE_FILE = "cache_test.cache";
+const string LISTED_FILE = "cache_test_a.csv";
+const string MISSING_FILE = "cache_test_b.csv";
+
+static void writeText(const string& path, const string& text)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    out << text;
+}
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static WeatherRecord makeRecord(int day, int month, int year, int hour, int minute, int second, float speed)
+{
+    WeatherRecord record;
+    record.SetDate(Date(day, month, year));
+    record.SetTime(Time(hour, minute, second));
+    record.SetWindSpeed(speed);
+    record.SetTemperature(speed - 10.0f);
+    record.SetSolarRadiation(speed * 3.0f);
+    return record;
+}
+
+// Same days, same records in the same order
+static bool sameMonth(const WeatherDatabase& a, const WeatherDatabase& b, int year, int month)
+{
+    const MonthColumns* left = a.GetMonthData(year, month);
+    const MonthColumns* right = b.GetMonthData(year, month);
+    if (left == nullptr || right == nullptr || left->getCount() != right->getCount())
+    {
+        return false;
+    }
+    for (int row = 0; row < left->getCount(); ++row)
+    {
+        WeatherRecord lr = left->GetRecord(row);
+        WeatherRecord rr = right->GetRecord(row);
+        if (lr.GetDate().GetDay() != rr.GetDate().GetDay() || lr.GetTime().GetHour() != rr.GetTime().GetHour()
+                || lr.GetTime().GetMinute() != rr.GetTime().GetMinute() || lr.GetTime().GetSecond() != rr.GetTime().GetSecond()
+                || lr.GetWindSpeed() != rr.GetWindSpeed() || lr.GetTemperature() != rr.GetTemperature()
+                || lr.GetSolarRadiation() != rr.GetSolarRadiation())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int loadCache(DuplicatePolicy policy = DuplicatePolicy::KeepAll)
+{
+    WeatherDatabase database;
+    database.SetDuplicatePolicy(policy);
+    return RecordCache::Load(database, CACHE_FILE, SOURCE_LIST);
+}
+
+static string readFile(const string& path)
+{
+    ifstream in(path, ios::binary);
+    return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+int main()
+{
+    cout << "--- RecordCache Unit Tests ---" << endl;
+
+    string listedPath = DATA_FOLDER + LISTED_FILE;
+    string missingPath = DATA_FOLDER + MISSING_FILE;
+    remove(CACHE_FILE);
+    remove(missingPath.c_str());
+    writeText(SOURCE_LIST, LISTED_FILE + "\n" + MISSING_FILE + "\n");
+    writeText(listedPath, "WAST,S,T,SR\n");
+
+    WeatherDatabase original;
+    original.Insert(makeRecord(3, 1, 2007, 9, 0, 0, 5.0f));
+    original.Insert(makeRecord(1, 1, 2007, 23, 59, 59, 6.0f));
+    original.Insert(makeRecord(3, 1, 2007, 8, 50, 30, 7.0f));
+    original.Insert(makeRecord(31, 12, 2008, 0, 0, 0, 8.0f));
+
+    // 1. A saved database loads back with the same months and rows
+    cout << "\n--- Round Trip Test ---" << endl;
+    bool saved = RecordCache::Save(original, CACHE_FILE, SOURCE_LIST);
+    WeatherDatabase loaded;
+    int loadedCount = RecordCache::Load(loaded, CACHE_FILE, SOURCE_LIST);
+    report("Round Trip Test", saved && loadedCount == 4 && loaded.GetRecordCount() == 4 && sameMonth(original, loaded, 2007, 1)
+           && sameMonth(original, loaded, 2008, 12) && loaded.GetMonthData(2007, 2) == nullptr);
+
+    // 2. A different duplicate policy needs a fresh parse
+    cout << "\n--- Duplicate Policy Test ---" << endl;
+    bool mismatchRejected = loadCache(DuplicatePolicy::FirstWins) == -1 && loadCache() == 4;
+    // The duplicates dropped before saving are reported again after a cached load
+    WeatherDatabase deduplicated;
+    deduplicated.SetDuplicatePolicy(DuplicatePolicy::FirstWins);
+    deduplicated.Insert(makeRecord(3, 1, 2007, 9, 0, 0, 5.0f));
+    deduplicated.Insert(makeRecord(3, 1, 2007, 9, 0, 30, 6.0f));
+    RecordCache::Save(deduplicated, CACHE_FILE, SOURCE_LIST);
+    WeatherDatabase reloaded;
+    reloaded.SetDuplicatePolicy(DuplicatePolicy::FirstWins);
+    bool countKept = RecordCache::Load(reloaded, CACHE_FILE, SOURCE_LIST) == 1 && reloaded.GetRecordCount() == 1
+                     && reloaded.GetDuplicateCount() == 1;
+    report("Duplicate Policy Test", mismatchRejected && countKept);
+
+    // 3. Changing the size of a listed file, or a missing one appearing, makes the cache stale
+    cout << "\n--- Size Change Test ---" << endl;
+    writeText(listedPath, "WAST,S,T,SR\n1/01/2007 9:00,5,22,660\n");
+    bool staleAfterAppend = loadCache() == -1;
+    RecordCache::Save(original, CACHE_FILE, SOURCE_LIST);
+    bool freshAfterSave = loadCache() == 4;
+    writeText(missingPath, "WAST,S,T,SR\n");
+    report("Size Change Test", staleAfterAppend && freshAfterSave && loadCache() == -1);
+
+    // 4. An edit that keeps the size within the same second is still seen
+    cout << "\n--- Modification Time Test ---" << endl;
+#ifndef _WIN32
+    struct timespec times[2];
+    times[0].tv_sec = 1000000000;
+    times[0].tv_nsec = 100;
+    times[1] = times[0];
+    utimensat(AT_FDCWD, listedPath.c_str(), times, 0);
+    RecordCache::Save(original, CACHE_FILE, SOURCE_LIST);
+    bool freshBefore = loadCache() == 4;
+    times[1].tv_nsec = 200;
+    utimensat(AT_FDCWD, listedPath.c_str(), times, 0);
+    report("Modification Time Test", freshBefore && loadCache() == -1);
+#else
+    cout << "(skipped: stat has whole-second times here)" << endl;
+#endif
+
+    // 5. Truncated or corrupt files are rejected without loading any record
+    cout << "\n--- Corrupt File Test ---" << endl;
+    RecordCache::Save(original, CACHE_FILE, SOURCE_LIST);
+    string good = readFile(CACHE_FILE);
+    bool rejected = !good.empty();
+    for (size_t length : {size_t(0), size_t(16), good.size() / 2, good.size() - 1})
+    {
+        writeText(CACHE_FILE, good.substr(0, length));
+        WeatherDatabase partial;
+        rejected = rejected && RecordCache::Load(partial, CACHE_FILE, SOURCE_LIST) == -1
+                   && partial.GetMonthData(2007, 1) == nullptr;
+    }
+    string badMagic = good;
+    badMagic[0] = 'X';
+    writeText(CACHE_FILE, badMagic);
+    rejected = rejected && loadCache() == -1;
+    writeText(CACHE_FILE, good);
+    report("Corrupt File Test", rejected && loadCache() == 4);
+
+    // 6. Timestamps the packed column cannot hold are not cached
+    cout << "\n--- Irregular Timestamp Test ---" << endl;
+    remove(CACHE_FILE);
+    WeatherDatabase irregular;
+    irregular.Insert(makeRecord(1, 1, 2007, 25, 0, 0, 1.0f));
+    bool refused = !RecordCache::Save(irregular, CACHE_FILE, SOURCE_LIST);
+    struct stat info;
+    report("Irregular Timestamp Test", refused && stat(CACHE_FILE, &info) != 0);
+
+    remove(CACHE_FILE);
+    remove(SOURCE_LIST);
+    remove(listedPath.c_str());
+    remove(missingPath.c_str());
+
+    cout << "\n--- End of RecordCache Unit Tests ---" << endl;
+    return 0;
+}
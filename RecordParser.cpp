@@ -0,0 +1,386 @@
+#include "RecordParser.h"
+#include "Types.h"
+#include <cstring>
+#include <cstdint>
+#include <charconv>
+
+// Exactly representable powers of ten for the float fast path
+static const float POWERS_OF_TEN[] =
+{
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+// Largest mantissa that a float holds exactly (2^24)
+const uint64_t MAX_EXACT_MANTISSA = 16777216;
+
+// Parses a leading integer like stoi: optional whitespace and sign, at least one digit,
+// trailing characters ignored.
+static RowStatus parseInt(string_view field, int& value)
+{
+    const char* p = field.data();
+    const char* end = p + field.size();
+    while (p < end && (*p == ' ' || *p == '\t'))
+    {
+        ++p;
+    }
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    if (p == end || *p < '0' || *p > '9')
+    {
+        return RowStatus::BadNumber;
+    }
+
+    long result = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        result = result * 10 + (*p - '0');
+        if (result > 2147483647L)
+        {
+            return RowStatus::OutOfRange;
+        }
+        ++p;
+    }
+
+    value = static_cast<int>(negative ? -result : result);
+    return RowStatus::Ok;
+}
+
+// Reads exactly 'count' digits starting at text[pos]
+static bool readDigits(string_view text, size_t pos, size_t count, int& value)
+{
+    if (pos + count > text.size())
+    {
+        return false;
+    }
+
+    int result = 0;
+    for (size_t i = pos; i < pos + count; ++i)
+    {
+        unsigned digit = static_cast<unsigned>(text[i] - '0');
+        if (digit > 9)
+        {
+            return false;
+        }
+        result = result * 10 + static_cast<int>(digit);
+    }
+    value = result;
+    return true;
+}
+
+// Reads a 1 or 2 digit number followed by 'separator'; advances pos past the separator
+static bool readShortField(string_view text, size_t& pos, char separator, int& value)
+{
+    size_t width = (pos + 1 < text.size() && text[pos + 1] != separator) ? 2 : 1;
+    if (!readDigits(text, pos, width, value) || pos + width >= text.size() || text[pos + width] != separator)
+    {
+        return false;
+    }
+    pos += width + 1;
+    return true;
+}
+
+// Splits "a<delim>b<delim>c" into up to three integers. Missing trailing parts
+// are left at 0 when optional is true, otherwise they are an error.
+static RowStatus parseTriple(string_view text, char delimiter, int parts[3], bool optional)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        size_t partEnd = (i < 2) ? text.find(delimiter) : text.size();
+        if (partEnd == string_view::npos)
+        {
+            if (!optional)
+            {
+                return RowStatus::BadNumber;
+            }
+            partEnd = text.size();
+        }
+
+        RowStatus status = parseInt(text.substr(0, partEnd), parts[i]);
+        if (status != RowStatus::Ok)
+        {
+            return status;
+        }
+
+        if (partEnd >= text.size())
+        {
+            break; // Remaining optional parts stay 0
+        }
+        text.remove_prefix(partEnd + 1);
+    }
+    return RowStatus::Ok;
+}
+
+// Slow path for timestamps outside the fixed station format (extra spaces, signs,
+// longer numbers): each part is read like stoi would read it.
+static RowStatus parseTimestampLenient(string_view dateTime, Date& date, Time& time)
+{
+    // assuming date time separated by a space
+    size_t spacePos = dateTime.find(' ');
+    if (spacePos == string_view::npos)
+    {
+        return RowStatus::Incomplete;
+    }
+
+    int dateParts[3] = {0, 0, 0};
+    RowStatus status = parseTriple(dateTime.substr(0, spacePos), DATE_DELIMITER, dateParts, false);
+    if (status != RowStatus::Ok)
+    {
+        return status;
+    }
+    date = Date(dateParts[0], dateParts[1], dateParts[2]);
+
+    // The seconds component is optional in the station exports ("9:00")
+    int timeParts[3] = {0, 0, 0};
+    status = parseTriple(dateTime.substr(spacePos + 1), TIME_DELIMITER, timeParts, true);
+    if (status != RowStatus::Ok)
+    {
+        return status;
+    }
+    time = Time(timeParts[0], timeParts[1], timeParts[2]);
+
+    return RowStatus::Ok;
+}
+
+RowStatus RecordParser::ParseDateTime(string_view text, Date& date, Time& time)
+{
+    if (ParseTimestamp(text, date, time))
+    {
+        return RowStatus::Ok;
+    }
+    return parseTimestampLenient(text, date, time);
+}
+
+const char* RecordParser::FindLineEnd(const char* p, const char* end)
+{
+    const void* newline = memchr(p, '\n', static_cast<size_t>(end - p));
+    return newline != nullptr ? static_cast<const char*>(newline) : end;
+}
+
+bool RecordParser::ResolveColumns(const CsvTokenizer& headerFields, ColumnLayout& layout)
+{
+    layout = ColumnLayout();
+    layout.columnCount = headerFields.getCount();
+
+    for (int i = 0; i < headerFields.getCount(); ++i)
+    {
+        string_view header = headerFields[i];
+
+        // Ignore a Windows line ending on the last header
+        if (!header.empty() && header.back() == '\r')
+        {
+            header.remove_suffix(1);
+        }
+
+        if (header == DATE_TIME_COLUMN)
+        {
+            layout.dateTimeIndex = i;
+        }
+
+        if (header == WIND_SPEED_COLUMN)
+        {
+            layout.windSpeedIndex = i;
+        }
+
+        if (header == AIR_TEMP_COLUMN)
+        {
+            layout.tempIndex = i;
+        }
+
+        if (header == SOLAR_RAD_COLUMN)
+        {
+            layout.solarRadIndex = i;
+        }
+    }
+
+    return layout.IsComplete();
+}
+
+bool RecordParser::ParseTimestamp(string_view text, Date& date, Time& time)
+{
+    // "D/M/YYYY H:MM" with an optional ":SS"; day, month and hour may have 1 or 2 digits
+    int day, month, year, hour, minute, second = 0;
+    size_t pos = 0;
+
+    if (!readShortField(text, pos, DATE_DELIMITER, day) || !readShortField(text, pos, DATE_DELIMITER, month))
+    {
+        return false;
+    }
+    if (!readDigits(text, pos, 4, year) || pos + 4 >= text.size() || text[pos + 4] != ' ')
+    {
+        return false;
+    }
+    pos += 5;
+
+    if (!readShortField(text, pos, TIME_DELIMITER, hour) || !readDigits(text, pos, 2, minute))
+    {
+        return false;
+    }
+    pos += 2;
+
+    if (pos < text.size())
+    {
+        if (text[pos] != TIME_DELIMITER || !readDigits(text, pos + 1, 2, second))
+        {
+            return false;
+        }
+        pos += 3;
+    }
+
+    // Tolerate a Windows line ending when WAST is the last column
+    if (pos < text.size() && !(pos + 1 == text.size() && text[pos] == '\r'))
+    {
+        return false;
+    }
+
+    date = Date(day, month, year);
+    time = Time(hour, minute, second);
+    return true;
+}
+
+RowStatus RecordParser::ParseFloat(string_view field, float& value)
+{
+    const char* p = field.data();
+    const char* end = p + field.size();
+
+    // Same leading characters that stof accepts
+    while (p < end && (*p == ' ' || *p == '\t'))
+    {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    // Fast path for plain decimals such as "12.75": with a mantissa of at most 2^24 and
+    // at most 10 fraction digits, both operands are exact floats and the single division
+    // is correctly rounded, giving the same result as strtof.
+    const char* q = p;
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int fractionDigits = 0;
+    bool seenPoint = false;
+    for (; q < end; ++q)
+    {
+        unsigned digit = static_cast<unsigned>(*q - '0');
+        if (digit <= 9)
+        {
+            // Once past 2^24 the fast path is ruled out, so stop accumulating
+            if (mantissa <= MAX_EXACT_MANTISSA)
+            {
+                mantissa = mantissa * 10 + digit;
+            }
+            digits++;
+            fractionDigits += seenPoint ? 1 : 0;
+        }
+        else if (*q == '.' && !seenPoint)
+        {
+            seenPoint = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    bool plainEnd = (q == end) || *q == '\r' || *q == CSV_DELIMITER;
+    if (digits > 0 && plainEnd && mantissa <= MAX_EXACT_MANTISSA && fractionDigits <= 10)
+    {
+        float result = static_cast<float>(mantissa) / POWERS_OF_TEN[fractionDigits];
+        value = negative ? -result : result;
+        return RowStatus::Ok;
+    }
+
+    // General case (exponents, long mantissas, trailing text): locale-independent from_chars
+    if (p < end && (*p == '+' || *p == '-'))
+    {
+        return RowStatus::BadNumber; // A second sign, e.g. "--5"
+    }
+    float result = 0.0f;
+    std::from_chars_result parsed = std::from_chars(p, end, result);
+    if (negative)
+    {
+        result = -result;
+    }
+    if (parsed.ec == std::errc::invalid_argument)
+    {
+        return RowStatus::BadNumber;
+    }
+    if (parsed.ec == std::errc::result_out_of_range)
+    {
+        return RowStatus::OutOfRange;
+    }
+
+    value = result;
+    return RowStatus::Ok;
+}
+
+void RecordParser::SetSensorValues(WeatherRecord& record, float windSpeed, float temperature, float solarRadiation)
+{
+    // Wind Speed (S): Assumed in m/s, converted to km/h (multiplying by 3.6)
+    record.SetWindSpeed(windSpeed * 3.6f);
+
+    // Temperature (T)
+    record.SetTemperature(temperature);
+
+    // Solar Radiation (SR)
+    // Record taken 10min apart
+    double time_step = 10.0 / 60.0;
+    // Convert power (W/m2) to energy (Wh/m2) by multiplying by the time step
+    double srEnergy = solarRadiation * time_step;
+    // Convert Wh/m2 to kWh/m2
+    double srEnergyK = srEnergy / 1000.0;
+    record.SetSolarRadiation(srEnergyK);
+}
+
+RowStatus RecordParser::ParseRow(const CsvTokenizer& fields, const ColumnLayout& layout, WeatherRecord& record)
+{
+    // Skip lines that don't have enough data
+    if (fields.getCount() < layout.columnCount)
+    {
+        return RowStatus::Incomplete;
+    }
+
+    // --- 1. Parse Date/Time (D/M/Y H:M[:S] - 24hr format) ---
+    string_view dateTime = fields[layout.dateTimeIndex];
+
+    Date recordDate;
+    Time recordTime;
+    RowStatus status = ParseDateTime(dateTime, recordDate, recordTime);
+    if (status != RowStatus::Ok)
+    {
+        return status;
+    }
+    record.SetDate(recordDate);
+    record.SetTime(recordTime);
+
+    // --- 2. Parse Data Values ---
+    float windSpeed = 0.0f;
+    float temperature = 0.0f;
+    float solarRadiation = 0.0f;
+
+    status = ParseFloat(fields[layout.windSpeedIndex], windSpeed);
+    if (status == RowStatus::Ok)
+    {
+        status = ParseFloat(fields[layout.tempIndex], temperature);
+    }
+    if (status == RowStatus::Ok)
+    {
+        status = ParseFloat(fields[layout.solarRadIndex], solarRadiation);
+    }
+    if (status != RowStatus::Ok)
+    {
+        return status;
+    }
+
+    SetSensorValues(record, windSpeed, temperature, solarRadiation);
+    return RowStatus::Ok;
+}
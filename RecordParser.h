@@ -0,0 +1,122 @@
+#ifndef RECORDPARSER_H_INCLUDED
+#define RECORDPARSER_H_INCLUDED
+
+#include "WeatherRecord.h"
+#include "CsvTokenizer.h"
+#include <cstddef>
+
+/**
+ * @struct ColumnLayout
+ * @brief Positions of the required columns, resolved once from a CSV header line.
+ */
+struct ColumnLayout
+{
+    int dateTimeIndex = -1;  //!< Index of the 'WAST' column.
+    int windSpeedIndex = -1; //!< Index of the 'S' column.
+    int tempIndex = -1;      //!< Index of the 'T' column.
+    int solarRadIndex = -1;  //!< Index of the 'SR' column.
+    int columnCount = 0;     //!< Number of columns in the header.
+
+    /**
+     * @brief Checks that every required column was found.
+     * @return true if all four column indexes are valid.
+     */
+    bool IsComplete() const
+    {
+        return dateTimeIndex != -1 && windSpeedIndex != -1 && tempIndex != -1 && solarRadIndex != -1;
+    }
+};
+
+/**
+ * @enum RowStatus
+ * @brief Outcome of parsing one CSV data row.
+ */
+enum class RowStatus
+{
+    Ok,          //!< The record was parsed successfully.
+    Incomplete,  //!< The row is blank, short, or has no date/time separator.
+    BadNumber,   //!< A date, time or data field is not numeric.
+    OutOfRange   //!< A numeric field does not fit the target type.
+};
+
+/**
+ * @class RecordParser
+ * @brief Parses weather CSV rows from tokenized fields.
+ *
+ * The fields are string_views into the caller's buffer (a getline string or a
+ * memory-mapped file), and they are converted straight from that buffer
+ * without allocating.
+ */
+class RecordParser
+{
+public:
+    /**
+     * @brief Resolves the required column indexes from a tokenized header line.
+     * @param headerFields The header line split into fields.
+     * @param layout Receives the column indexes and column count.
+     * @return true if all required columns ('WAST', 'S', 'T', 'SR') were found.
+     */
+    static bool ResolveColumns(const CsvTokenizer& headerFields, ColumnLayout& layout);
+
+    /**
+     * @brief Parses one tokenized data row into a WeatherRecord.
+     * @param fields The row split into fields.
+     * @param layout The column layout resolved from the header.
+     * @param record Receives the parsed values when the row is valid.
+     * @return RowStatus::Ok on success, otherwise the reason the row was rejected.
+     */
+    static RowStatus ParseRow(const CsvTokenizer& fields, const ColumnLayout& layout, WeatherRecord& record);
+
+    /**
+     * @brief Parses a WAST timestamp in the fixed station format "D/M/YYYY H:MM[:SS]".
+     * Day, month and hour may have one or two digits; the seconds are optional and
+     * default to 0. Anything else (extra spaces, signs, other widths) is rejected so
+     * the caller can fall back to a lenient parser.
+     * @param text The timestamp field.
+     * @param date Receives the date on success.
+     * @param time Receives the time on success.
+     * @return true if the text matched the fixed format.
+     */
+    static bool ParseTimestamp(string_view text, Date& date, Time& time);
+
+    /**
+     * @brief Parses a WAST timestamp, trying ParseTimestamp first and falling back
+     * to reading each part like stoi for anything outside the fixed format.
+     * @param text The timestamp field.
+     * @param date Receives the date on success.
+     * @param time Receives the time on success.
+     * @return RowStatus::Ok, or the reason the timestamp was rejected.
+     */
+    static RowStatus ParseDateTime(string_view text, Date& date, Time& time);
+
+    /**
+     * @brief Converts a numeric field to float without exceptions or locale lookups.
+     * Accepts the same leading text as std::stof (whitespace, sign) and ignores
+     * trailing characters; the value is identical to what strtof returns.
+     * @param field The field text.
+     * @param value Receives the parsed number on success.
+     * @return RowStatus::Ok, RowStatus::BadNumber or RowStatus::OutOfRange.
+     */
+    static RowStatus ParseFloat(string_view field, float& value);
+
+    /**
+     * @brief Stores the raw sensor readings in a record, applying unit conversions.
+     * Wind speed is converted from m/s to km/h and solar radiation from a
+     * 10 minute W/m2 reading to kWh/m2.
+     * @param record The record to update.
+     * @param windSpeed Raw 'S' reading.
+     * @param temperature Raw 'T' reading.
+     * @param solarRadiation Raw 'SR' reading.
+     */
+    static void SetSensorValues(WeatherRecord& record, float windSpeed, float temperature, float solarRadiation);
+
+    /**
+     * @brief Finds the end of the line starting at p.
+     * @param p Start of the search.
+     * @param end End of the buffer.
+     * @return Pointer to the '\n' terminating the line, or end if there is none.
+     */
+    static const char* FindLineEnd(const char* p, const char* end);
+};
+
+#endif // RECORDPARSER_H_INCLUDED
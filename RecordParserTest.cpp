@@ -0,0 +1,145 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include "RecordParser.h"
+#include "CsvTokenizer.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+// ParseFloat must agree bit for bit with strtof (what std::stof uses)
+static bool matchesStrtof(string_view field)
+{
+    string text(field);
+    char* end = nullptr;
+    float expected = strtof(text.c_str(), &end);
+    bool expectedOk = (end != text.c_str());
+
+    float actual = 0.0f;
+    bool actualOk = (RecordParser::ParseFloat(field, actual) == RowStatus::Ok);
+
+    return expectedOk == actualOk && (!expectedOk || memcmp(&expected, &actual, sizeof(float)) == 0);
+}
+
+int main()
+{
+    cout << "--- RecordParser Unit Tests ---" << endl;
+
+    // 1. Timestamp Without Seconds Test
+    cout << "\n--- Timestamp Without Seconds Test ---" << endl;
+    Date date;
+    Time time;
+    bool parsed = RecordParser::ParseTimestamp("1/01/2007 9:00", date, time);
+    cout << "Parsed: " << date << " " << time << endl; // Should be 1/1/2007 09:00:00
+    if (parsed && date.GetDay() == 1 && date.GetMonth() == 1 && date.GetYear() == 2007
+            && time.GetHour() == 9 && time.GetMinute() == 0 && time.GetSecond() == 0)
+    {
+        cout << "Timestamp Without Seconds Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Timestamp Without Seconds Test: FAILED" << endl;
+    }
+
+    // 2. Timestamp With Seconds Test
+    cout << "\n--- Timestamp With Seconds Test ---" << endl;
+    parsed = RecordParser::ParseTimestamp("31/12/2016 23:50:15", date, time);
+    cout << "Parsed: " << date << " " << time << endl; // Should be 31/12/2016 23:50:15
+    if (parsed && date.GetDay() == 31 && date.GetMonth() == 12 && date.GetYear() == 2016
+            && time.GetHour() == 23 && time.GetMinute() == 50 && time.GetSecond() == 15)
+    {
+        cout << "Timestamp With Seconds Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Timestamp With Seconds Test: FAILED" << endl;
+    }
+
+    // 3. Malformed Timestamp Test (rejected by the fixed-format parser)
+    cout << "\n--- Malformed Timestamp Test ---" << endl;
+    const char* badTimestamps[] = { "", "1/01/2007", "1-01-2007 9:00", "1/01/07 9:00", "1/01/2007 9:0", "x/01/2007 9:00", "1/01/2007 9:00 AM" };
+    bool allRejected = true;
+    for (const char* text : badTimestamps)
+    {
+        allRejected = allRejected && !RecordParser::ParseTimestamp(text, date, time);
+    }
+    if (allRejected)
+    {
+        cout << "Malformed Timestamp Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Malformed Timestamp Test: FAILED" << endl;
+    }
+
+    // 4. Float Return Code Test
+    cout << "\n--- Float Return Code Test ---" << endl;
+    float value = 0.0f;
+    if (RecordParser::ParseFloat("abc", value) == RowStatus::BadNumber
+            && RecordParser::ParseFloat("", value) == RowStatus::BadNumber
+            && RecordParser::ParseFloat("--5", value) == RowStatus::BadNumber
+            && RecordParser::ParseFloat("1e99", value) == RowStatus::OutOfRange
+            && RecordParser::ParseFloat(" 12.5", value) == RowStatus::Ok && value == 12.5f)
+    {
+        cout << "Float Return Code Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Float Return Code Test: FAILED" << endl;
+    }
+
+    // 5. Float Edge Case Test (fast path and from_chars fallback against strtof)
+    cout << "\n--- Float Edge Case Test ---" << endl;
+    const char* floats[] = { "0", "-0", "20.74", "-3.5", "+7", "1013.4", "9031.33", "0.1", "16777216",
+                             "16777217", "123456789.123", "1.5e3", "0.0000000001", "12abc", ".5", "5." };
+    bool edgesMatch = true;
+    for (const char* text : floats)
+    {
+        if (!matchesStrtof(text))
+        {
+            cout << "Mismatch for \"" << text << "\"" << endl;
+            edgesMatch = false;
+        }
+    }
+    cout << "Float Edge Case Test: " << (edgesMatch ? "PASSED" : "FAILED") << endl;
+
+    // 6. Data File Test (every field of every data row must match strtof)
+    cout << "\n--- Data File Test ---" << endl;
+    MappedFile file;
+    if (file.Open("data/Metdata-Jan-Dec2007.csv"))
+    {
+        CsvTokenizer tokenizer(',');
+        const char* p = file.GetData();
+        const char* end = p + file.GetSize();
+        p = RecordParser::FindLineEnd(p, end) + 1; // Skip the header
+        long fields = 0;
+        long timestamps = 0;
+        bool dataMatches = true;
+        while (p < end)
+        {
+            const char* lineEnd = RecordParser::FindLineEnd(p, end);
+            tokenizer.Tokenize(string_view(p, lineEnd - p));
+            if (tokenizer.getCount() > 0)
+            {
+                timestamps += RecordParser::ParseTimestamp(tokenizer[0], date, time) ? 1 : 0;
+            }
+            for (int i = 1; i < tokenizer.getCount(); ++i)
+            {
+                dataMatches = dataMatches && matchesStrtof(tokenizer[i]);
+                fields++;
+            }
+            p = (lineEnd < end) ? lineEnd + 1 : end;
+        }
+        cout << fields << " fields compared, " << timestamps << " fixed-format timestamps" << endl;
+        cout << "Data File Test: " << (dataMatches ? "PASSED" : "FAILED") << endl;
+    }
+    else
+    {
+        cout << "Data File Test: SKIPPED (data/Metdata-Jan-Dec2007.csv not found)" << endl;
+    }
+
+    cout << "\n--- End of RecordParser Unit Tests ---" << endl;
+
+    return 0;
+}
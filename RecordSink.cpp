@@ -0,0 +1,105 @@
+#include "RecordSink.h"
+#include <cmath>
+#include <iomanip>
+
+using std::endl;
+using std::fixed;
+using std::setfill;
+using std::setprecision;
+using std::setw;
+
+void DatabaseSink::Consume(const WeatherRecord* records, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        m_weatherRecords.Insert(records[i]);
+    }
+}
+
+CsvExportSink::CsvExportSink(ostream& out) : m_out(out)
+{
+    m_out << "WAST,S,T,SR" << '\n';
+}
+
+void CsvExportSink::Consume(const WeatherRecord* records, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const Date& date = records[i].GetDate();
+        const Time& time = records[i].GetTime();
+        m_out << date.GetDay() << '/' << date.GetMonth() << '/' << date.GetYear() << ' '
+              << time.GetHour() << ':' << setfill('0') << setw(2) << time.GetMinute() << setfill(' ') << ','
+              << records[i].GetWindSpeed() << ',' << records[i].GetTemperature() << ','
+              << records[i].GetSolarRadiation() << '\n';
+    }
+}
+
+void CsvExportSink::Finish()
+{
+    m_out.flush();
+}
+
+void MonthSummary::Add(const WeatherRecord& record)
+{
+    count++;
+
+    double delta = record.GetWindSpeed() - windSpeedMean;
+    windSpeedMean += delta / count;
+    windSpeedM2 += delta * (record.GetWindSpeed() - windSpeedMean);
+
+    delta = record.GetTemperature() - temperatureMean;
+    temperatureMean += delta / count;
+    temperatureM2 += delta * (record.GetTemperature() - temperatureMean);
+
+    solarRadiationTotal += record.GetSolarRadiation();
+}
+
+double MonthSummary::GetWindSpeedStandardDeviation() const
+{
+    return (count < 2) ? 0.0 : sqrt(windSpeedM2 / (count - 1));
+}
+
+double MonthSummary::GetTemperatureStandardDeviation() const
+{
+    return (count < 2) ? 0.0 : sqrt(temperatureM2 / (count - 1));
+}
+
+void MonthlyStatsSink::Consume(const WeatherRecord* records, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const Date& date = records[i].GetDate();
+        m_summaries[date.GetYear() * 100 + date.GetMonth()].Add(records[i]);
+    }
+}
+
+const MonthSummary* MonthlyStatsSink::GetSummary(int year, int month) const
+{
+    MonthSummaryMap::const_iterator it = m_summaries.find(year * 100 + month);
+    return (it == m_summaries.end()) ? nullptr : &it->second;
+}
+
+const MonthSummaryMap& MonthlyStatsSink::GetSummaries() const
+{
+    return m_summaries;
+}
+
+void MonthlyStatsSink::Print(ostream& out) const
+{
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << "Year,Month,Records,S mean,S sd,T mean,T sd,SR total" << endl;
+    for (MonthSummaryMap::const_iterator it = m_summaries.begin(); it != m_summaries.end(); ++it)
+    {
+        const MonthSummary& summary = it->second;
+        out << it->first / 100 << ',' << it->first % 100 << ',' << summary.count << ','
+            << fixed << setprecision(1)
+            << summary.windSpeedMean << ',' << summary.GetWindSpeedStandardDeviation() << ','
+            << summary.temperatureMean << ',' << summary.GetTemperatureStandardDeviation() << ','
+            << summary.solarRadiationTotal << endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,142 @@
+#ifndef RECORDSINK_H_INCLUDED
+#define RECORDSINK_H_INCLUDED
+
+#include "WeatherRecord.h"
+#include "WeatherDatabase.h"
+#include <map>
+#include <ostream>
+
+using std::ostream;
+
+/**
+ * @class RecordSink
+ * @brief Consumer end of a record stream (see RecordSource and PumpRecords).
+ */
+class RecordSink
+{
+public:
+    virtual ~RecordSink() = default;
+
+    /**
+     * @brief Receives the next batch of records. The buffer is only valid during the call.
+     * @param records The records, in source order.
+     * @param count The number of records in the batch.
+     */
+    virtual void Consume(const WeatherRecord* records, int count) = 0;
+
+    /**
+     * @brief Called once after the last batch.
+     */
+    virtual void Finish() {}
+};
+
+/**
+ * @class DatabaseSink
+ * @brief Inserts every streamed record into a WeatherDatabase.
+ */
+class DatabaseSink : public RecordSink
+{
+public:
+    /**
+     * @param weatherRecords The database to fill; must outlive the sink.
+     */
+    explicit DatabaseSink(WeatherDatabase& weatherRecords) : m_weatherRecords(weatherRecords) {}
+
+    void Consume(const WeatherRecord* records, int count) override;
+
+private:
+    WeatherDatabase& m_weatherRecords; //!< Destination database.
+};
+
+/**
+ * @class CsvExportSink
+ * @brief Writes streamed records as "WAST,S,T,SR" CSV rows.
+ * Values are written in report units (km/h, degrees C, kWh/m2), not the raw sensor units.
+ */
+class CsvExportSink : public RecordSink
+{
+public:
+    /**
+     * @brief Writes the header line.
+     * @param out The output stream; must outlive the sink.
+     */
+    explicit CsvExportSink(ostream& out);
+
+    void Consume(const WeatherRecord* records, int count) override;
+    void Finish() override;
+
+private:
+    ostream& m_out; //!< Destination stream.
+};
+
+/**
+ * @struct MonthSummary
+ * @brief Running statistics of one month, updated one record at a time.
+ * Means and variances use Welford's method so no record has to be kept.
+ */
+struct MonthSummary
+{
+    long count = 0;                   //!< Records seen.
+    double windSpeedMean = 0.0;       //!< Running mean of S.
+    double windSpeedM2 = 0.0;         //!< Sum of squared differences from the S mean.
+    double temperatureMean = 0.0;     //!< Running mean of T.
+    double temperatureM2 = 0.0;       //!< Sum of squared differences from the T mean.
+    double solarRadiationTotal = 0.0; //!< Sum of SR.
+
+    /**
+     * @brief Folds one record into the summary.
+     * @param record The record to add.
+     */
+    void Add(const WeatherRecord& record);
+
+    /**
+     * @brief Sample standard deviation of wind speed.
+     * @return The standard deviation, or 0 with fewer than two records.
+     */
+    double GetWindSpeedStandardDeviation() const;
+
+    /**
+     * @brief Sample standard deviation of temperature.
+     * @return The standard deviation, or 0 with fewer than two records.
+     */
+    double GetTemperatureStandardDeviation() const;
+};
+
+/// @brief Month summaries keyed by year * 100 + month, so iteration is chronological.
+typedef std::map<int, MonthSummary> MonthSummaryMap;
+
+/**
+ * @class MonthlyStatsSink
+ * @brief One-pass per-month statistics over a record stream.
+ * Memory use depends on the number of months, not the number of records.
+ */
+class MonthlyStatsSink : public RecordSink
+{
+public:
+    void Consume(const WeatherRecord* records, int count) override;
+
+    /**
+     * @brief Gets the summary of one month.
+     * @param year The year.
+     * @param month The month (1-12).
+     * @return The summary, or nullptr if no record of that month was seen.
+     */
+    const MonthSummary* GetSummary(int year, int month) const;
+
+    /**
+     * @brief Gets every month seen, in chronological order.
+     * @return The summaries keyed by year * 100 + month.
+     */
+    const MonthSummaryMap& GetSummaries() const;
+
+    /**
+     * @brief Writes one CSV line per month: year, month, count, S mean/sd, T mean/sd, SR total.
+     * @param out The output stream.
+     */
+    void Print(ostream& out) const;
+
+private:
+    MonthSummaryMap m_summaries; //!< Accumulated months.
+};
+
+#endif // RECORDSINK_H_INCLUDED
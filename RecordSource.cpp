@@ -0,0 +1,186 @@
+#include "RecordSource.h"
+#include "RecordSink.h"
+#include "Types.h"
+
+CsvRecordSource::CsvRecordSource(const string& filename, bool skipUnfinishedLine)
+    : m_file(), m_tokenizer(CSV_DELIMITER), m_layout(), m_line(), m_lineNumber(1), m_stats(), m_isOpen(false),
+      m_atEnd(false), m_skipUnfinishedLine(skipUnfinishedLine)
+{
+    m_stats.filename = filename;
+    if (!m_file.Open(filename))
+    {
+        addInputError();
+        m_stats.AddMessage("Error: Could not open file " + filename);
+        return;
+    }
+
+    string headerLine;
+    if (!m_file.ReadLine(headerLine))
+    {
+        addInputError();
+        m_stats.AddMessage("Error: Could not read header line from file " + filename);
+        return;
+    }
+
+    m_stats.bytes += headerLine.size() + 1;
+    if (m_file.LastLineEnded())
+    {
+        m_stats.followOffset = m_stats.bytes;
+    }
+    m_tokenizer.Tokenize(headerLine);
+    if (!RecordParser::ResolveColumns(m_tokenizer, m_layout))
+    {
+        m_stats.AddMessage("Error: One or more required columns ('WAST', 'S', 'T', 'SR') not found in the header.");
+        return;
+    }
+
+    m_stats.loaded = true;
+    m_isOpen = true;
+}
+
+bool CsvRecordSource::IsOpen() const
+{
+    return m_isOpen;
+}
+
+const FileIngestStats& CsvRecordSource::GetStats() const
+{
+    return m_stats;
+}
+
+// Keeps the reason the file failed, if InputFile gave one
+void CsvRecordSource::addInputError()
+{
+    if (!m_file.GetError().empty())
+    {
+        m_stats.AddMessage(m_file.GetError());
+    }
+}
+
+int CsvRecordSource::NextBatch(WeatherRecord* records, int capacity)
+{
+    if (!m_isOpen)
+    {
+        return -1;
+    }
+
+    int count = 0;
+    while (count < capacity && m_file.ReadLine(m_line))
+    {
+        bool lineEnded = m_file.LastLineEnded();
+        if (m_skipUnfinishedLine && !lineEnded)
+        {
+            break; // The writer may still be adding to it
+        }
+        m_lineNumber++;
+        m_stats.bytes += m_line.size() + 1;
+        if (lineEnded)
+        {
+            m_stats.followOffset = m_stats.bytes;
+        }
+        m_tokenizer.Tokenize(m_line);
+
+        RowStatus status = RecordParser::ParseRow(m_tokenizer, m_layout, records[count]);
+        if (status != RowStatus::Ok)
+        {
+            m_stats.AddIssue(status, m_lineNumber);
+            continue;
+        }
+        count++;
+    }
+    if (count < capacity && !m_atEnd)
+    {
+        m_atEnd = true;
+        addInputError(); // Stopped at the end of the file or on a read error
+    }
+    m_stats.rowsAccepted += count;
+    return count;
+}
+
+SourceListRecordSource::SourceListRecordSource(const string& sourceFilename)
+    : m_list(sourceFilename), m_current(), m_currentName(), m_currentStart(), m_report()
+{
+    if (!m_list.is_open())
+    {
+        cerr << "Error: Could not open source file: " << sourceFilename << endl;
+    }
+}
+
+bool SourceListRecordSource::IsOpen() const
+{
+    return m_list.is_open();
+}
+
+const IngestReport& SourceListRecordSource::GetReport() const
+{
+    return m_report;
+}
+
+// Moves the statistics of the current file into the report
+void SourceListRecordSource::finishFile(bool loaded)
+{
+    FileIngestStats stats = m_current->GetStats();
+    stats.filename = m_currentName;
+    stats.loaded = loaded;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_currentStart).count();
+    cerr << stats.messages;
+    m_report.AddFile(stats);
+    m_current.reset();
+}
+
+int SourceListRecordSource::NextBatch(WeatherRecord* records, int capacity)
+{
+    if (!m_list.is_open())
+    {
+        return -1;
+    }
+
+    while (true)
+    {
+        if (m_current)
+        {
+            int count = m_current->NextBatch(records, capacity);
+            if (count > 0)
+            {
+                return count;
+            }
+            finishFile(true);
+        }
+
+        // Move on to the next listed file
+        string filename;
+        if (!getline(m_list, filename))
+        {
+            return 0;
+        }
+
+        m_currentName = filename;
+        m_currentStart = std::chrono::steady_clock::now();
+        m_current.reset(new CsvRecordSource(DATA_FOLDER + filename));
+        if (!m_current->IsOpen())
+        {
+            finishFile(false);
+            cerr << "ERROR: Failed to load data from " << filename << ". Skipping file." << endl;
+        }
+    }
+}
+
+long PumpRecords(RecordSource& source, RecordSink& sink, int batchSize)
+{
+    if (batchSize < 1)
+    {
+        batchSize = DEFAULT_BATCH_SIZE;
+    }
+
+    std::unique_ptr<WeatherRecord[]> batch(new WeatherRecord[batchSize]);
+    long total = 0;
+    int count;
+    while ((count = source.NextBatch(batch.get(), batchSize)) > 0)
+    {
+        sink.Consume(batch.get(), count);
+        total += count;
+    }
+
+    sink.Finish();
+    return (count < 0 && total == 0) ? -1 : total;
+}
@@ -0,0 +1,138 @@
+#ifndef RECORDSOURCE_H_INCLUDED
+#define RECORDSOURCE_H_INCLUDED
+
+#include "WeatherRecord.h"
+#include "RecordParser.h"
+#include "CsvTokenizer.h"
+#include "IngestReport.h"
+#include "InputFile.h"
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using std::string;
+using std::ifstream;
+
+class RecordSink;
+
+/// @brief Number of records pulled per batch by PumpRecords.
+const int DEFAULT_BATCH_SIZE = 1024;
+
+/**
+ * @class RecordSource
+ * @brief Pull-based stream of parsed weather records.
+ *
+ * A source hands out records in batches into a buffer owned by the caller, so
+ * memory use is bounded by the batch size no matter how large the input is.
+ * Sources do not know where the records go; see RecordSink.
+ */
+class RecordSource
+{
+public:
+    virtual ~RecordSource() = default;
+
+    /**
+     * @brief Parses the next records into the caller's buffer.
+     * @param records Buffer to fill.
+     * @param capacity Maximum number of records to write.
+     * @return The number of records written, 0 at the end of the data, or -1 on error.
+     */
+    virtual int NextBatch(WeatherRecord* records, int capacity) = 0;
+};
+
+/**
+ * @class CsvRecordSource
+ * @brief Streams the records of one weather CSV file, reading a line at a time.
+ * Gzip-compressed files are inflated as they are read (see InputFile).
+ */
+class CsvRecordSource : public RecordSource
+{
+public:
+    /**
+     * @brief Opens the file and resolves the column layout from its header.
+     * Errors leave the source closed; their messages are kept in GetStats().messages.
+     * @param filename The path to the CSV file.
+     * @param skipUnfinishedLine true to leave a final line without its '\n' unread, e.g. for FileFollower.
+     */
+    explicit CsvRecordSource(const string& filename, bool skipUnfinishedLine = false);
+
+    /**
+     * @brief Checks that the file was opened and has the required columns.
+     * @return true if records can be read.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets the rows accepted and rejected so far. Rejected rows are only counted, never printed;
+     * errors about the file (e.g. a failed read) are kept in messages.
+     * @return The file's statistics (seconds is left for the caller to fill in).
+     */
+    const FileIngestStats& GetStats() const;
+
+    int NextBatch(WeatherRecord* records, int capacity) override;
+
+private:
+    void addInputError();
+
+    InputFile m_file;          //!< The open CSV file.
+    CsvTokenizer m_tokenizer;  //!< Re-used field table.
+    ColumnLayout m_layout;     //!< Columns resolved from the header.
+    string m_line;             //!< Re-used line buffer.
+    long m_lineNumber;         //!< Line number of m_line (1 = header).
+    FileIngestStats m_stats;   //!< Counters for this file.
+    bool m_isOpen;             //!< True once the header was validated.
+    bool m_atEnd;              //!< True once ReadLine has returned false.
+    bool m_skipUnfinishedLine; //!< True to ignore a final line without its '\n'.
+};
+
+/**
+ * @class SourceListRecordSource
+ * @brief Streams every CSV named in a source list (e.g. data_source.txt) in list order.
+ * Each file's error messages are printed on cerr when it is finished; files
+ * that cannot be opened are reported and skipped.
+ */
+class SourceListRecordSource : public RecordSource
+{
+public:
+    /**
+     * @brief Opens the source list. File names are read lazily as each file is finished.
+     * @param sourceFilename The file containing the list of CSV filenames.
+     */
+    explicit SourceListRecordSource(const string& sourceFilename);
+
+    /**
+     * @brief Checks that the source list was opened.
+     * @return true if the list could be read.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets the statistics of every file finished so far, in list order.
+     * @return The ingest report.
+     */
+    const IngestReport& GetReport() const;
+
+    int NextBatch(WeatherRecord* records, int capacity) override;
+
+private:
+    void finishFile(bool loaded);
+
+    ifstream m_list;                            //!< The open source list.
+    std::unique_ptr<CsvRecordSource> m_current; //!< The file currently being read.
+    string m_currentName;                       //!< Listed name of m_current.
+    std::chrono::steady_clock::time_point m_currentStart; //!< When m_current was opened.
+    IngestReport m_report;                      //!< Statistics of the finished files.
+};
+
+/**
+ * @brief Moves every record from a source to a sink, one batch at a time.
+ * Calls sink.Finish() once the source is exhausted.
+ * @param source The records to read.
+ * @param sink The consumer of the records.
+ * @param batchSize Number of records buffered per step.
+ * @return The number of records passed to the sink, or -1 if the source failed before producing any.
+ */
+long PumpRecords(RecordSource& source, RecordSink& sink, int batchSize = DEFAULT_BATCH_SIZE);
+
+#endif // RECORDSOURCE_H_INCLUDED
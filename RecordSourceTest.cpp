@@ -0,0 +1,218 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include "RecordSource.h"
+#include "RecordSink.h"
+#include "RecordCache.h"
+#include "Types.h"
+
+using namespace std;
+
+// CsvRecordSource takes a path; SourceListRecordSource looks its files up in DATA_FOLDER
+const string CSV_FILE = "source_test.csv";
+const string SOURCE_LIST = "source_test_sources.txt";
+const string LISTED_A = "source_test_a.csv";
+const string LISTED_B = "source_test_b.csv";
+const string CACHE_FILE = "source_test.cache";
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+static void writeText(const string& path, const string& text)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    out << text;
+}
+
+static bool near(double a, double b)
+{
+    return fabs(a - b) <= 1e-6 * (1.0 + fabs(b));
+}
+
+static WeatherRecord makeRecord(int day, int month, int year, int hour, int minute, float speed, float temperature)
+{
+    WeatherRecord record;
+    record.SetDate(Date(day, month, year));
+    record.SetTime(Time(hour, minute, 0));
+    record.SetWindSpeed(speed);
+    record.SetTemperature(temperature);
+    record.SetSolarRadiation(speed / 10.0f);
+    return record;
+}
+
+/**
+ * @brief Keeps every streamed record and the size of the largest batch.
+ */
+class CollectSink : public RecordSink
+{
+public:
+    void Consume(const WeatherRecord* records, int count) override
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            received.PushBack(records[i]);
+        }
+        largestBatch = (count > largestBatch) ? count : largestBatch;
+    }
+
+    void Finish() override
+    {
+        finished = true;
+    }
+
+    Vector<WeatherRecord> received;
+    int largestBatch = 0;
+    bool finished = false;
+};
+
+int main()
+{
+    cout << "--- RecordSource Unit Tests ---" << endl;
+
+    // Five good rows around one with a non-numeric value; S is m/s and SR W/m2 in the file
+    writeText(CSV_FILE, "WAST,S,T,SR\n"
+              "1/01/2007 9:00,1,20,600\n"
+              "1/01/2007 9:10,2,21,0\n"
+              "1/01/2007 9:20,x,22,0\n"
+              "1/01/2007 9:30,3,23,0\n"
+              "2/01/2007 9:00,4,24,0\n"
+              "1/02/2007 9:00,5,25,0\n");
+
+    // 1. Batches smaller than the file come back in order, then 0 at the end
+    cout << "\n--- Batch Boundary Test ---" << endl;
+    CsvRecordSource source(CSV_FILE);
+    WeatherRecord batch[2];
+    int first = source.NextBatch(batch, 2);
+    bool firstRows = first == 2 && batch[0].GetTime().GetMinute() == 0 && batch[1].GetTime().GetMinute() == 10
+                     && near(batch[0].GetWindSpeed(), 3.6) && near(batch[0].GetSolarRadiation(), 0.1);
+    int second = source.NextBatch(batch, 2);
+    bool skippedBadRow = second == 2 && batch[0].GetTime().GetMinute() == 30 && batch[1].GetDate().GetDay() == 2;
+    int third = source.NextBatch(batch, 2);
+    int atEnd = source.NextBatch(batch, 2);
+    report("Batch Boundary Test", source.IsOpen() && firstRows && skippedBadRow && third == 1
+           && batch[0].GetDate().GetMonth() == 2 && atEnd == 0
+           && source.GetStats().GetRejectedCount() == 1
+           && source.GetStats().issueCounts[static_cast<int>(RowStatus::BadNumber)] == 1
+           && source.GetStats().sampleLines[static_cast<int>(RowStatus::BadNumber)][0] == 4
+           && source.GetStats().rowsAccepted == 5 && source.GetStats().messages.empty());
+
+    // 2. PumpRecords never hands the sink more than one batch at a time
+    cout << "\n--- Pump Batch Test ---" << endl;
+    CsvRecordSource pumped(CSV_FILE);
+    CollectSink collected;
+    long pumpedCount = PumpRecords(pumped, collected, 2);
+    report("Pump Batch Test", pumpedCount == 5 && collected.received.getCount() == 5 && collected.largestBatch == 2
+           && collected.finished && collected.received[4].GetTemperature() == 25.0f);
+
+    // 3. A source that fails before producing anything makes PumpRecords return -1
+    cout << "\n--- Pump Failure Test ---" << endl;
+    CsvRecordSource missing("no_such_file.csv");
+    CollectSink nothing;
+    report("Pump Failure Test", !missing.IsOpen() && PumpRecords(missing, nothing) == -1
+           && nothing.received.getCount() == 0
+           && missing.GetStats().messages == "Error: Could not open file no_such_file.csv\n");
+
+    // 4. Welford's running mean and deviation agree with a two-pass calculation
+    cout << "\n--- Monthly Stats Test ---" << endl;
+    Vector<WeatherRecord> records;
+    for (int i = 0; i < 500; ++i)
+    {
+        // A large offset makes a naive sum-of-squares lose precision
+        float speed = 10000.0f + static_cast<float>((i * 37) % 101) / 4.0f;
+        float temperature = -5.0f + static_cast<float>((i * 53) % 71) / 2.0f;
+        records.PushBack(makeRecord(1 + i % 28, 3, 2010, i % 24, (i * 10) % 60, speed, temperature));
+    }
+    records.PushBack(makeRecord(1, 4, 2010, 0, 0, 7.0f, 8.0f));
+    MonthlyStatsSink monthly;
+    monthly.Consume(&records[0], 200);
+    monthly.Consume(&records[200], records.getCount() - 200);
+
+    double speedSum = 0.0;
+    double temperatureSum = 0.0;
+    double solarSum = 0.0;
+    for (int i = 0; i < 500; ++i)
+    {
+        speedSum += records[i].GetWindSpeed();
+        temperatureSum += records[i].GetTemperature();
+        solarSum += records[i].GetSolarRadiation();
+    }
+    double speedMean = speedSum / 500;
+    double temperatureMean = temperatureSum / 500;
+    double speedSquares = 0.0;
+    double temperatureSquares = 0.0;
+    for (int i = 0; i < 500; ++i)
+    {
+        speedSquares += (records[i].GetWindSpeed() - speedMean) * (records[i].GetWindSpeed() - speedMean);
+        temperatureSquares += (records[i].GetTemperature() - temperatureMean) * (records[i].GetTemperature() - temperatureMean);
+    }
+    const MonthSummary* march = monthly.GetSummary(2010, 3);
+    const MonthSummary* april = monthly.GetSummary(2010, 4);
+    report("Monthly Stats Test", march != nullptr && march->count == 500 && near(march->windSpeedMean, speedMean)
+           && near(march->GetWindSpeedStandardDeviation(), sqrt(speedSquares / 499))
+           && near(march->temperatureMean, temperatureMean)
+           && near(march->GetTemperatureStandardDeviation(), sqrt(temperatureSquares / 499))
+           && near(march->solarRadiationTotal, solarSum)
+           && april != nullptr && april->count == 1 && april->GetWindSpeedStandardDeviation() == 0.0
+           && monthly.GetSummary(2010, 5) == nullptr && monthly.GetSummaries().size() == 2);
+
+    // 5. Exported rows use D/M/YYYY H:MM and the stored report units
+    cout << "\n--- CSV Export Test ---" << endl;
+    ostringstream exported;
+    WeatherRecord exportRows[2] = { makeRecord(5, 3, 2010, 9, 5, 1.5f, 20.0f),
+                                    makeRecord(31, 12, 2010, 23, 50, 12.0f, -2.5f)
+                                  };
+    CsvExportSink exporter(exported);
+    exporter.Consume(exportRows, 2);
+    exporter.Finish();
+    report("CSV Export Test", exported.str() == "WAST,S,T,SR\n5/3/2010 9:05,1.5,20,0.15\n31/12/2010 23:50,12,-2.5,1.2\n");
+
+    // 6. A source list streams its files in list order, skips those it cannot open and reports each
+    cout << "\n--- Source List Test ---" << endl;
+    string listedA = DATA_FOLDER + LISTED_A;
+    string listedB = DATA_FOLDER + LISTED_B;
+    writeText(listedA, "WAST,S,T,SR\n1/01/2008 9:00,1,11,0\n1/01/2008 9:10,2,12,0\n");
+    writeText(listedB, "WAST,S,T,SR\n1/01/2007 9:00,3,13,0\n");
+    writeText(SOURCE_LIST, LISTED_A + "\nsource_test_missing.csv\n" + LISTED_B + "\n");
+    SourceListRecordSource list(SOURCE_LIST);
+    CollectSink listed;
+    long listedCount = PumpRecords(list, listed, 1);
+    const IngestReport& listReport = list.GetReport();
+    report("Source List Test", list.IsOpen() && listedCount == 3 && listed.received[0].GetTemperature() == 11.0f
+           && listed.received[1].GetTemperature() == 12.0f && listed.received[2].GetTemperature() == 13.0f
+           && listReport.getCount() == 3 && listReport.GetFile(0).rowsAccepted == 2
+           && !listReport.GetFile(1).loaded && listReport.GetFile(2).filename == LISTED_B);
+
+    // 7. A cache streams its records in year, month and day order; a stale one does not open
+    cout << "\n--- Cache Source Test ---" << endl;
+    WeatherDatabase database;
+    database.Insert(makeRecord(2, 1, 2008, 8, 0, 4.0f, 14.0f));
+    database.Insert(makeRecord(1, 1, 2008, 9, 0, 5.0f, 15.0f));
+    database.Insert(makeRecord(1, 12, 2007, 9, 0, 6.0f, 16.0f));
+    database.Insert(makeRecord(1, 1, 2008, 7, 0, 7.0f, 17.0f));
+    bool saved = RecordCache::Save(database, CACHE_FILE, SOURCE_LIST);
+    CacheRecordSource cached(CACHE_FILE, SOURCE_LIST);
+    CollectSink fromCache;
+    long cachedCount = PumpRecords(cached, fromCache, 3);
+    bool cacheOrder = cachedCount == 4 && fromCache.received[0].GetTemperature() == 16.0f
+                      && fromCache.received[1].GetTemperature() == 15.0f && fromCache.received[2].GetTemperature() == 17.0f
+                      && fromCache.received[3].GetTemperature() == 14.0f && fromCache.received[3].GetTime().GetHour() == 8;
+    writeText(listedB, "WAST,S,T,SR\n");
+    CacheRecordSource stale(CACHE_FILE, SOURCE_LIST);
+    CollectSink fromStale;
+    report("Cache Source Test", saved && cached.IsOpen() && cacheOrder && !stale.IsOpen()
+           && PumpRecords(stale, fromStale) == -1);
+
+    remove(CSV_FILE.c_str());
+    remove(SOURCE_LIST.c_str());
+    remove(CACHE_FILE.c_str());
+    remove(listedA.c_str());
+    remove(listedB.c_str());
+
+    cout << "\n--- End of RecordSource Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,280 @@
+#ifndef RINGBUFFER_H_INCLUDED
+#define RINGBUFFER_H_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/// @brief Times Push/Pop yield before they go to sleep on a full or empty queue.
+const int RING_BUFFER_SPIN_COUNT = 64;
+
+/**
+ * @class RingBuffer
+ * @brief Bounded lock-free queue for handing work between threads.
+ *
+ * Each cell carries a sequence number that says whether it is ready to be
+ * written or read in the current lap (D. Vyukov's bounded MPMC queue), so
+ * producers and consumers only contend on their own position counter and no
+ * locks are taken. Any number of threads may push and pop.
+ *
+ * The capacity is fixed; TryPush fails when the queue is full, which is what
+ * gives a pipeline backpressure. Push/Pop are the blocking forms: they yield a
+ * few times and then sleep on a condition variable until there is room or
+ * data, so a stage that waits on a slow neighbour does not hold a core. The
+ * mutex is only taken by sleeping threads and by whoever wakes them.
+ */
+template <class T>
+class RingBuffer
+{
+public:
+    /**
+     * @brief Creates an empty queue.
+     * @param capacity Number of cells; rounded up to a power of two (minimum 2).
+     */
+    explicit RingBuffer(size_t capacity);
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /**
+     * @brief Moves a value into the queue if there is room.
+     * @param value The value; left moved-from on success, untouched on failure.
+     * @return true if the value was queued, false if the queue was full.
+     */
+    bool TryPush(T& value);
+
+    /**
+     * @brief Moves the oldest value out of the queue if there is one.
+     * @param value Receives the value.
+     * @return true if a value was taken, false if the queue was empty.
+     */
+    bool TryPop(T& value);
+
+    /**
+     * @brief Queues a value, waiting while the queue is full.
+     * @param value The value; left moved-from.
+     */
+    void Push(T& value);
+
+    /**
+     * @brief Takes the oldest value, waiting while the queue is empty.
+     * @param value Receives the value.
+     */
+    void Pop(T& value);
+
+    /**
+     * @brief Gets the number of cells.
+     * @return The capacity.
+     */
+    size_t GetCapacity() const;
+
+    /**
+     * @brief Gets the number of queued values. Only a snapshot while other threads are active.
+     * @return The approximate occupancy.
+     */
+    size_t GetSize() const;
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    /// @brief TryPush without waking sleepers.
+    bool tryPushCell(T& value);
+
+    /// @brief TryPop without waking sleepers.
+    bool tryPopCell(T& value);
+
+    /// @brief Wakes the threads sleeping in Push/Pop, if any, after a cell changed state.
+    void wakeSleepers();
+
+    size_t m_mask;                               //!< capacity - 1.
+    std::unique_ptr<Cell[]> m_cells;             //!< The ring.
+    alignas(64) std::atomic<size_t> m_enqueuePos; //!< Next cell to write.
+    alignas(64) std::atomic<size_t> m_dequeuePos; //!< Next cell to read.
+    alignas(64) std::atomic<int> m_sleepers;      //!< Threads sleeping (or about to) in Push/Pop.
+    std::mutex m_sleepMutex;                      //!< Guards the sleep/wake handshake.
+    std::condition_variable m_changed;            //!< Signalled when a cell was filled or freed.
+};
+
+template <class T>
+RingBuffer<T>::RingBuffer(size_t capacity)
+    : m_mask(0), m_cells(), m_enqueuePos(0), m_dequeuePos(0), m_sleepers(0), m_sleepMutex(), m_changed()
+{
+    size_t size = 2;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    m_mask = size - 1;
+    m_cells.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+bool RingBuffer<T>::TryPush(T& value)
+{
+    if (!tryPushCell(value))
+    {
+        return false;
+    }
+    wakeSleepers();
+    return true;
+}
+
+template <class T>
+bool RingBuffer<T>::TryPop(T& value)
+{
+    if (!tryPopCell(value))
+    {
+        return false;
+    }
+    wakeSleepers();
+    return true;
+}
+
+template <class T>
+bool RingBuffer<T>::tryPushCell(T& value)
+{
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell& cell = m_cells[pos & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            // The cell is free in this lap; claim it
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.data = std::move(value);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false; // Full: the cell still holds last lap's value
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class T>
+bool RingBuffer<T>::tryPopCell(T& value)
+{
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell& cell = m_cells[pos & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            // The cell was written in this lap; claim it
+            if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                value = std::move(cell.data);
+                cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false; // Empty
+        }
+        else
+        {
+            pos = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class T>
+void RingBuffer<T>::wakeSleepers()
+{
+    // Pairs with the fence in Push/Pop: either the sleeper sees the new cell state, or we see the sleeper
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleepers.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_changed.notify_all();
+    }
+}
+
+template <class T>
+void RingBuffer<T>::Push(T& value)
+{
+    for (int spin = 0; spin < RING_BUFFER_SPIN_COUNT; ++spin)
+    {
+        if (TryPush(value))
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_sleepers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!tryPushCell(value))
+    {
+        m_changed.wait(lock);
+    }
+    m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    lock.unlock();
+    wakeSleepers(); // A thread waiting for the opposite state may be asleep too
+}
+
+template <class T>
+void RingBuffer<T>::Pop(T& value)
+{
+    for (int spin = 0; spin < RING_BUFFER_SPIN_COUNT; ++spin)
+    {
+        if (TryPop(value))
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_sleepers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!tryPopCell(value))
+    {
+        m_changed.wait(lock);
+    }
+    m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    lock.unlock();
+    wakeSleepers(); // A thread waiting for the opposite state may be asleep too
+}
+
+template <class T>
+size_t RingBuffer<T>::GetCapacity() const
+{
+    return m_mask + 1;
+}
+
+template <class T>
+size_t RingBuffer<T>::GetSize() const
+{
+    size_t enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+    size_t dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+    return (enqueued > dequeued) ? enqueued - dequeued : 0;
+}
+
+#endif // RINGBUFFER_H_INCLUDED
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+#include "RingBuffer.h"
+
+using namespace std;
+
+int main()
+{
+    cout << "--- RingBuffer Unit Tests ---" << endl;
+
+    // 1. Capacity / Full / Empty Test
+    cout << "\n--- Capacity Test ---" << endl;
+    RingBuffer<int> small(3); // Rounded up to 4
+    int value = 0;
+    bool ok = small.GetCapacity() == 4 && !small.TryPop(value);
+    for (int i = 0; i < 4; ++i)
+    {
+        value = i;
+        ok = ok && small.TryPush(value);
+    }
+    value = 99;
+    ok = ok && !small.TryPush(value) && value == 99 && small.GetSize() == 4;
+    cout << "Capacity Test: " << (ok ? "PASSED" : "FAILED") << endl;
+
+    // 2. FIFO Order Test
+    cout << "\n--- FIFO Order Test ---" << endl;
+    ok = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        ok = ok && small.TryPop(value) && value == i;
+    }
+    ok = ok && !small.TryPop(value) && small.GetSize() == 0;
+    cout << "FIFO Order Test: " << (ok ? "PASSED" : "FAILED") << endl;
+
+    // 3. Concurrent Test: 2 producers, 3 consumers, every value seen exactly once
+    cout << "\n--- Concurrent Test ---" << endl;
+    const int perProducer = 200000;
+    RingBuffer<int> queue(64);
+    vector<int> seen(2 * perProducer, 0);
+    vector<thread> threads;
+    for (int p = 0; p < 2; ++p)
+    {
+        threads.emplace_back([&queue, p]()
+        {
+            for (int i = 0; i < perProducer; ++i)
+            {
+                int v = p * perProducer + i;
+                queue.Push(v);
+            }
+        });
+    }
+    vector<long> consumed(3, 0);
+    for (int c = 0; c < 3; ++c)
+    {
+        threads.emplace_back([&queue, &seen, &consumed, c]()
+        {
+            int v;
+            while (true)
+            {
+                queue.Pop(v);
+                if (v < 0)
+                {
+                    return;
+                }
+                seen[v]++;
+                consumed[c]++;
+            }
+        });
+    }
+    threads[0].join();
+    threads[1].join();
+    for (int c = 0; c < 3; ++c)
+    {
+        int stop = -1;
+        queue.Push(stop);
+    }
+    for (size_t t = 2; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    ok = consumed[0] + consumed[1] + consumed[2] == 2L * perProducer;
+    for (int i = 0; ok && i < 2 * perProducer; ++i)
+    {
+        ok = (seen[i] == 1);
+    }
+    cout << "Concurrent Test: " << (ok ? "PASSED" : "FAILED") << endl;
+
+    // 4. Sleeping Test: a Pop on an empty queue and a Push on a full one sleep instead of spinning
+    cout << "\n--- Sleeping Test ---" << endl;
+    RingBuffer<int> handoff(2);
+    int received = 0;
+    clock_t cpuStart = clock();
+    thread consumer([&handoff, &received]()
+    {
+        int v;
+        handoff.Pop(v); // Waits for the first value
+        received = v;
+        this_thread::sleep_for(chrono::milliseconds(200));
+        for (int i = 0; i < 3; ++i)
+        {
+            handoff.Pop(v);
+            received += v;
+        }
+    });
+    this_thread::sleep_for(chrono::milliseconds(200));
+    for (int i = 1; i <= 4; ++i)
+    {
+        value = i;
+        handoff.Push(value); // The fourth waits for the consumer to wake up
+    }
+    consumer.join();
+    double cpuSeconds = double(clock() - cpuStart) / CLOCKS_PER_SEC;
+    cout << "CPU time while waiting: " << cpuSeconds << " s" << endl;
+    cout << "Sleeping Test: " << (received == 10 && cpuSeconds < 0.1 ? "PASSED" : "FAILED") << endl;
+
+    cout << "\n--- End of RingBuffer Unit Tests ---" << endl;
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "SensorFrame.h"
+#include <stdexcept>
+
+SensorFrame::SensorFrame(const SensorSchema& schema)
+    : m_schema(schema), m_dates(), m_times(),
+      m_columns(schema.GetCount() > 0 ? new Vector<float>[schema.GetCount()] : nullptr)
+{
+}
+
+const SensorSchema& SensorFrame::GetSchema() const
+{
+    return m_schema;
+}
+
+void SensorFrame::Append(const Date& date, const Time& time, const float* values)
+{
+    m_dates.PushBack(date);
+    m_times.PushBack(time);
+    for (int slot = 0; slot < m_schema.GetCount(); ++slot)
+    {
+        m_columns[slot].PushBack(values[slot]);
+    }
+}
+
+void SensorFrame::AppendFrame(const SensorFrame& other)
+{
+    for (int row = 0; row < other.getCount(); ++row)
+    {
+        m_dates.PushBack(other.m_dates[row]);
+        m_times.PushBack(other.m_times[row]);
+        for (int slot = 0; slot < m_schema.GetCount(); ++slot)
+        {
+            m_columns[slot].PushBack(other.m_columns[slot][row]);
+        }
+    }
+}
+
+int SensorFrame::getCount() const
+{
+    return m_dates.getCount();
+}
+
+const Date& SensorFrame::GetDate(int row) const
+{
+    return m_dates[row];
+}
+
+const Time& SensorFrame::GetTime(int row) const
+{
+    return m_times[row];
+}
+
+bool SensorFrame::HasColumn(Sensor sensor) const
+{
+    return m_schema.Contains(sensor);
+}
+
+const Vector<float>& SensorFrame::GetColumn(Sensor sensor) const
+{
+    int slot = m_schema.GetSlot(sensor);
+    if (slot < 0)
+    {
+        throw std::out_of_range("Sensor column was not loaded.");
+    }
+    return m_columns[slot];
+}
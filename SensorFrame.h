@@ -0,0 +1,92 @@
+#ifndef SENSORFRAME_H_INCLUDED
+#define SENSORFRAME_H_INCLUDED
+
+#include "SensorSchema.h"
+#include "Vector.h"
+#include "Date.h"
+#include "Time.h"
+#include <memory>
+
+/**
+ * @class SensorFrame
+ * @brief Column-per-sensor storage for the sensors of a SensorSchema.
+ *
+ * Every row has a date and time plus one float per schema slot. Only the
+ * columns in the schema are allocated, so loading two extra sensors costs two
+ * float columns rather than a full 17-value record per row.
+ */
+class SensorFrame
+{
+public:
+    /**
+     * @brief Creates an empty frame with one column per sensor in the schema.
+     * @param schema The sensors to store.
+     */
+    explicit SensorFrame(const SensorSchema& schema);
+
+    SensorFrame(const SensorFrame&) = delete;
+    SensorFrame& operator=(const SensorFrame&) = delete;
+
+    /**
+     * @brief Gets the schema the frame was created with.
+     * @return The schema.
+     */
+    const SensorSchema& GetSchema() const;
+
+    /**
+     * @brief Appends one row.
+     * @param date The row's date.
+     * @param time The row's time.
+     * @param values One value per schema slot.
+     */
+    void Append(const Date& date, const Time& time, const float* values);
+
+    /**
+     * @brief Appends every row of another frame.
+     * @param other A frame created with the same schema.
+     */
+    void AppendFrame(const SensorFrame& other);
+
+    /**
+     * @brief Gets the number of rows.
+     * @return The row count.
+     */
+    int getCount() const;
+
+    /**
+     * @brief Gets the date of a row.
+     * @param row The row index.
+     * @return The date.
+     */
+    const Date& GetDate(int row) const;
+
+    /**
+     * @brief Gets the time of a row.
+     * @param row The row index.
+     * @return The time.
+     */
+    const Time& GetTime(int row) const;
+
+    /**
+     * @brief Checks whether a sensor column was loaded.
+     * @param sensor The sensor.
+     * @return true if the frame has the column.
+     */
+    bool HasColumn(Sensor sensor) const;
+
+    /**
+     * @brief Gets the values of one sensor, one per row.
+     * @param sensor The sensor; must be part of the schema.
+     * @return The column.
+     * @throws std::out_of_range if the sensor was not loaded.
+     */
+    const Vector<float>& GetColumn(Sensor sensor) const;
+
+private:
+    SensorSchema m_schema;                    //!< Sensors stored in this frame.
+    Vector<Date> m_dates;                     //!< Date of each row.
+    Vector<Time> m_times;                     //!< Time of each row.
+    std::unique_ptr<Vector<float>[]> m_columns; //!< One column per schema slot.
+};
+
+#endif // SENSORFRAME_H_INCLUDED
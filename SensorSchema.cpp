@@ -0,0 +1,164 @@
+#include "SensorSchema.h"
+#include "Types.h"
+
+// Header names, in Sensor order
+static const char* const SENSOR_NAMES[SENSOR_COUNT] =
+{
+    "DP", "Dta", "Dts", "EV", "QFE", "QFF", "QNH", "RF", "RH",
+    "S", "SR", "ST1", "ST2", "ST3", "ST4", "Sx", "T"
+};
+
+SensorSchema::SensorSchema() : m_mask(0), m_count(0)
+{
+    rebuildSlots();
+}
+
+void SensorSchema::Add(Sensor sensor)
+{
+    m_mask |= 1u << static_cast<int>(sensor);
+    rebuildSlots();
+}
+
+bool SensorSchema::Contains(Sensor sensor) const
+{
+    return (m_mask & (1u << static_cast<int>(sensor))) != 0;
+}
+
+int SensorSchema::GetCount() const
+{
+    return m_count;
+}
+
+Sensor SensorSchema::GetSensor(int slot) const
+{
+    return m_sensors[slot];
+}
+
+int SensorSchema::GetSlot(Sensor sensor) const
+{
+    return m_slots[static_cast<int>(sensor)];
+}
+
+// Slots follow Sensor order, so a schema does not depend on the order of Add calls
+void SensorSchema::rebuildSlots()
+{
+    m_count = 0;
+    for (int i = 0; i < SENSOR_COUNT; ++i)
+    {
+        if (m_mask & (1u << i))
+        {
+            m_slots[i] = m_count;
+            m_sensors[m_count] = static_cast<Sensor>(i);
+            m_count++;
+        }
+        else
+        {
+            m_slots[i] = -1;
+        }
+    }
+}
+
+bool SensorSchema::ResolveColumns(const CsvTokenizer& headerFields, SchemaLayout& layout) const
+{
+    layout = SchemaLayout();
+    layout.columnCount = headerFields.getCount();
+    for (int slot = 0; slot < m_count; ++slot)
+    {
+        layout.valueIndexes[slot] = -1;
+    }
+
+    for (int i = 0; i < headerFields.getCount(); ++i)
+    {
+        string_view header = headerFields[i];
+
+        // Ignore a Windows line ending on the last header
+        if (!header.empty() && header.back() == '\r')
+        {
+            header.remove_suffix(1);
+        }
+
+        Sensor sensor;
+        if (header == DATE_TIME_COLUMN)
+        {
+            layout.dateTimeIndex = i;
+        }
+        else if (FindSensor(header, sensor) && Contains(sensor))
+        {
+            layout.valueIndexes[GetSlot(sensor)] = i;
+        }
+    }
+
+    if (layout.dateTimeIndex == -1)
+    {
+        return false;
+    }
+    for (int slot = 0; slot < m_count; ++slot)
+    {
+        if (layout.valueIndexes[slot] == -1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+RowStatus SensorSchema::ParseRow(const CsvTokenizer& fields, const SchemaLayout& layout,
+                                 Date& date, Time& time, float* values) const
+{
+    // Skip lines that don't have enough data
+    if (fields.getCount() < layout.columnCount)
+    {
+        return RowStatus::Incomplete;
+    }
+
+    RowStatus status = RecordParser::ParseDateTime(fields[layout.dateTimeIndex], date, time);
+    if (status != RowStatus::Ok)
+    {
+        return status;
+    }
+
+    // Only the requested columns are converted; the rest stay untouched views
+    for (int slot = 0; slot < m_count; ++slot)
+    {
+        status = RecordParser::ParseFloat(fields[layout.valueIndexes[slot]], values[slot]);
+        if (status != RowStatus::Ok)
+        {
+            return status;
+        }
+    }
+    return RowStatus::Ok;
+}
+
+const char* SensorSchema::GetName(Sensor sensor)
+{
+    return SENSOR_NAMES[static_cast<int>(sensor)];
+}
+
+bool SensorSchema::FindSensor(string_view name, Sensor& sensor)
+{
+    for (int i = 0; i < SENSOR_COUNT; ++i)
+    {
+        if (name == SENSOR_NAMES[i])
+        {
+            sensor = static_cast<Sensor>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SensorSchema::ParseList(const string& list, SensorSchema& schema)
+{
+    CsvTokenizer names(CSV_DELIMITER);
+    names.Tokenize(list);
+    for (int i = 0; i < names.getCount(); ++i)
+    {
+        Sensor sensor;
+        if (!FindSensor(names[i], sensor))
+        {
+            return false;
+        }
+        schema.Add(sensor);
+    }
+    return schema.GetCount() > 0;
+}
@@ -0,0 +1,151 @@
+#ifndef SENSORSCHEMA_H_INCLUDED
+#define SENSORSCHEMA_H_INCLUDED
+
+#include "RecordParser.h"
+#include "CsvTokenizer.h"
+#include "Date.h"
+#include "Time.h"
+#include <cstdint>
+#include <string>
+
+using std::string;
+
+/**
+ * @enum Sensor
+ * @brief The sensor columns of a station export, named after their CSV headers.
+ */
+enum class Sensor
+{
+    DP,  //!< Dew point.
+    Dta, //!< Wind direction (10 minute average).
+    Dts, //!< Wind direction standard deviation.
+    EV,  //!< Evaporation.
+    QFE, //!< Station level pressure.
+    QFF, //!< Sea level pressure (QFF).
+    QNH, //!< Sea level pressure (QNH).
+    RF,  //!< Rainfall.
+    RH,  //!< Relative humidity.
+    S,   //!< Wind speed.
+    SR,  //!< Solar radiation.
+    ST1, //!< Soil temperature 1.
+    ST2, //!< Soil temperature 2.
+    ST3, //!< Soil temperature 3.
+    ST4, //!< Soil temperature 4.
+    Sx,  //!< Maximum wind speed.
+    T    //!< Ambient air temperature.
+};
+
+/// @brief Number of values in the Sensor enum.
+const int SENSOR_COUNT = 17;
+
+/**
+ * @struct SchemaLayout
+ * @brief CSV column of every sensor in a SensorSchema, resolved from a header line.
+ */
+struct SchemaLayout
+{
+    int dateTimeIndex = -1;                //!< Index of the 'WAST' column.
+    int columnCount = 0;                   //!< Number of columns in the header.
+    int valueIndexes[SENSOR_COUNT] = {};   //!< Column of each schema slot.
+};
+
+/**
+ * @class SensorSchema
+ * @brief The set of sensor columns a caller wants loaded.
+ *
+ * Each requested sensor gets a slot (0 .. GetCount()-1, in Sensor order). Rows are
+ * parsed straight into a slot-indexed float array, and columns outside the schema
+ * are never converted.
+ */
+class SensorSchema
+{
+public:
+    SensorSchema();
+
+    /**
+     * @brief Adds a sensor to the schema. Adding a sensor twice has no effect.
+     * @param sensor The sensor to load.
+     */
+    void Add(Sensor sensor);
+
+    /**
+     * @brief Checks whether a sensor is part of the schema.
+     * @param sensor The sensor.
+     * @return true if it will be loaded.
+     */
+    bool Contains(Sensor sensor) const;
+
+    /**
+     * @brief Gets the number of requested sensors.
+     * @return The number of slots.
+     */
+    int GetCount() const;
+
+    /**
+     * @brief Gets the sensor stored in a slot.
+     * @param slot A slot index in [0, GetCount()).
+     * @return The sensor.
+     */
+    Sensor GetSensor(int slot) const;
+
+    /**
+     * @brief Gets the slot of a sensor.
+     * @param sensor The sensor.
+     * @return The slot index, or -1 if the sensor is not in the schema.
+     */
+    int GetSlot(Sensor sensor) const;
+
+    /**
+     * @brief Resolves the column of every requested sensor from a tokenized header line.
+     * @param headerFields The header line split into fields.
+     * @param layout Receives the column indexes.
+     * @return true if 'WAST' and every requested sensor column were found.
+     */
+    bool ResolveColumns(const CsvTokenizer& headerFields, SchemaLayout& layout) const;
+
+    /**
+     * @brief Parses the timestamp and the requested sensor values of one row.
+     * Values are stored as read (station units, no conversion).
+     * @param fields The row split into fields.
+     * @param layout The layout resolved from the header.
+     * @param date Receives the row's date.
+     * @param time Receives the row's time.
+     * @param values Receives GetCount() values, one per slot.
+     * @return RowStatus::Ok on success, otherwise the reason the row was rejected.
+     */
+    RowStatus ParseRow(const CsvTokenizer& fields, const SchemaLayout& layout,
+                       Date& date, Time& time, float* values) const;
+
+    /**
+     * @brief Gets the CSV header name of a sensor.
+     * @param sensor The sensor.
+     * @return The column name, e.g. "RH".
+     */
+    static const char* GetName(Sensor sensor);
+
+    /**
+     * @brief Looks up a sensor by its CSV header name (case sensitive).
+     * @param name The column name.
+     * @param sensor Receives the sensor when found.
+     * @return true if the name is a known sensor column.
+     */
+    static bool FindSensor(string_view name, Sensor& sensor);
+
+    /**
+     * @brief Builds a schema from a comma separated list of column names, e.g. "RH,QFE".
+     * @param list The column names.
+     * @param schema Receives the sensors.
+     * @return false if a name is not a known sensor column.
+     */
+    static bool ParseList(const string& list, SensorSchema& schema);
+
+private:
+    void rebuildSlots();
+
+    uint32_t m_mask;                   //!< Bit per requested Sensor.
+    int m_count;                       //!< Number of requested sensors.
+    Sensor m_sensors[SENSOR_COUNT];    //!< Sensor of each slot.
+    int m_slots[SENSOR_COUNT];         //!< Slot of each Sensor, or -1.
+};
+
+#endif // SENSORSCHEMA_H_INCLUDED
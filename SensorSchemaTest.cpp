@@ -0,0 +1,93 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "SensorSchema.h"
+#include "SensorFrame.h"
+#include "CsvTokenizer.h"
+
+using namespace std;
+
+static void report(const string& name, bool passed)
+{
+    cout << name << ": " << (passed ? "PASSED" : "FAILED") << endl;
+}
+
+int main()
+{
+    cout << "--- SensorSchema Unit Tests ---" << endl;
+
+    // 1. Column lists: slots follow Sensor order, repeats are ignored, unknown names fail
+    cout << "\n--- Parse List Test ---" << endl;
+    SensorSchema schema;
+    bool parsed = SensorSchema::ParseList("RH,QFE,RH", schema);
+    bool slotsOk = schema.GetCount() == 2 && schema.GetSlot(Sensor::QFE) == 0 && schema.GetSlot(Sensor::RH) == 1
+                   && schema.GetSensor(1) == Sensor::RH && schema.GetSlot(Sensor::T) == -1 && !schema.Contains(Sensor::S);
+    SensorSchema unknown;
+    SensorSchema lowerCase;
+    SensorSchema empty;
+    bool rejected = !SensorSchema::ParseList("RH,XYZ", unknown) && !SensorSchema::ParseList("rh", lowerCase)
+                    && !SensorSchema::ParseList("", empty);
+    report("Parse List Test", parsed && slotsOk && rejected);
+
+    // 2. Columns are found wherever they are in the header, including before a Windows line ending
+    cout << "\n--- Reordered Header Test ---" << endl;
+    CsvTokenizer tokenizer(',');
+    string reordered = "RH,WAST,T,S,QFE\r";
+    tokenizer.Tokenize(reordered);
+    SchemaLayout layout;
+    bool resolved = schema.ResolveColumns(tokenizer, layout);
+    report("Reordered Header Test", resolved && layout.dateTimeIndex == 1 && layout.columnCount == 5
+           && layout.valueIndexes[schema.GetSlot(Sensor::QFE)] == 4 && layout.valueIndexes[schema.GetSlot(Sensor::RH)] == 0);
+
+    // 3. A header without WAST or without a requested sensor cannot be loaded
+    cout << "\n--- Missing Column Test ---" << endl;
+    SchemaLayout missingLayout;
+    string noSensor = "WAST,RH,T";
+    tokenizer.Tokenize(noSensor);
+    bool missingSensor = !schema.ResolveColumns(tokenizer, missingLayout);
+    string noTimestamp = "RH,QFE,T";
+    tokenizer.Tokenize(noTimestamp);
+    bool missingTimestamp = !schema.ResolveColumns(tokenizer, missingLayout);
+    report("Missing Column Test", missingSensor && missingTimestamp);
+
+    // 4. Columns outside the schema are skipped without being converted
+    cout << "\n--- Skipped Column Test ---" << endl;
+    Date date;
+    Time time;
+    float values[SENSOR_COUNT];
+    string row = "55,1/02/2010 9:30,not a number,,1012.5";
+    tokenizer.Tokenize(row);
+    bool rowOk = schema.ParseRow(tokenizer, layout, date, time, values) == RowStatus::Ok
+                 && values[schema.GetSlot(Sensor::RH)] == 55.0f && values[schema.GetSlot(Sensor::QFE)] == 1012.5f
+                 && date.GetMonth() == 2 && time.GetMinute() == 30;
+    string badValue = "55,1/02/2010 9:30,20,5,abc";
+    tokenizer.Tokenize(badValue);
+    bool badRejected = schema.ParseRow(tokenizer, layout, date, time, values) == RowStatus::BadNumber;
+    string shortRow = "55,1/02/2010 9:30,20";
+    tokenizer.Tokenize(shortRow);
+    bool shortRejected = schema.ParseRow(tokenizer, layout, date, time, values) == RowStatus::Incomplete;
+    report("Skipped Column Test", rowOk && badRejected && shortRejected);
+
+    // 5. A frame keeps one column per requested sensor
+    cout << "\n--- Sensor Frame Test ---" << endl;
+    SensorFrame frame(schema);
+    float first[2] = {1010.0f, 40.0f};
+    float second[2] = {1011.0f, 45.0f};
+    frame.Append(Date(1, 2, 2010), Time(9, 0, 0), first);
+    frame.Append(Date(1, 2, 2010), Time(9, 10, 0), second);
+    bool threw = false;
+    try
+    {
+        frame.GetColumn(Sensor::T);
+    }
+    catch (const out_of_range&)
+    {
+        threw = true;
+    }
+    report("Sensor Frame Test", frame.getCount() == 2 && frame.GetColumn(Sensor::RH)[1] == 45.0f
+           && frame.GetColumn(Sensor::QFE)[0] == 1010.0f && frame.GetTime(1).GetMinute() == 10
+           && frame.HasColumn(Sensor::QFE) && !frame.HasColumn(Sensor::T) && threw);
+
+    cout << "\n--- End of SensorSchema Unit Tests ---" << endl;
+    return 0;
+}
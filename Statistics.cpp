@@ -1,74 +1,7 @@
 #include "Statistics.h"
-#include "WeatherRecord.h"
-#include "Types.h"
 #include <cmath>
 #include <stdexcept>
 
-float Statistics::GetValue(const WeatherRecord& record, string dataType)
-{
-    if (dataType == WIND_SPEED_COLUMN)
-    {
-        return record.GetWindSpeed();
-    }
-    else if (dataType == AIR_TEMP_COLUMN)
-    {
-        return record.GetTemperature();
-    }
-    else if (dataType == SOLAR_RAD_COLUMN)
-    {
-        return record.GetSolarRadiation();
-    }
-    return 0.0f;
-}
-
-double Statistics::CalculateTotal(const Vector<WeatherRecord>& weatherRecords, string dataType)
-{
-    if (weatherRecords.getCount() == 0)
-    {
-        return 0.0;
-    }
-
-    double sum = 0.0;
-    for (int i = 0; i < weatherRecords.getCount(); ++i)
-    {
-        sum += GetValue(weatherRecords[i], dataType);
-    }
-    return sum;
-}
-
-double Statistics::CalculateAverage(const Vector<WeatherRecord>& weatherRecords, string dataType)
-{
-    int count = weatherRecords.getCount();
-    if (count == 0)
-    {
-        return 0.0;
-    }
-
-    double total = CalculateTotal(weatherRecords, dataType);
-    return total / count;
-}
-
-double Statistics::CalculateStandardDeviation(
-    const Vector<WeatherRecord>& weatherRecords,
-    double averageValue,
-    string dataType)
-{
-    int count = weatherRecords.getCount();
-    if (count < 2)
-    {
-        return 0.0; // Cannot calculate sample SD with less than 2 points
-    }
-
-    double sumSquaredDifferences = 0.0;
-    for (int i = 0; i < count; ++i)
-    {
-        double value = GetValue(weatherRecords[i], dataType);
-        sumSquaredDifferences += pow(value - averageValue, 2);
-    }
-
-    return sqrt(sumSquaredDifferences / (count - 1));
-}
-
 double Statistics::CalculateSPCC(const Vector<float>& dataX, const Vector<float>& dataY)
 {
     int n = dataX.getCount();
@@ -113,12 +46,44 @@ double Statistics::CalculateSPCC(const Vector<float>& dataX, const Vector<float>
     return numerator / denominator;
 }
 
-double Statistics::CalculateMAD(
-    const Vector<WeatherRecord>& weatherRecords,
-    double averageValue,
-    string dataType)
+double Statistics::CalculateTotal(const float* values, int count)
+{
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+
+double Statistics::CalculateAverage(const float* values, int count)
+{
+    if (count == 0)
+    {
+        return 0.0;
+    }
+    return CalculateTotal(values, count) / count;
+}
+
+double Statistics::CalculateStandardDeviation(const float* values, int count, double averageValue)
+{
+    if (count < 2)
+    {
+        return 0.0; // Cannot calculate sample SD with less than 2 points
+    }
+
+    double sumSquaredDifferences = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+        double value = values[i];
+        sumSquaredDifferences += pow(value - averageValue, 2);
+    }
+
+    return sqrt(sumSquaredDifferences / (count - 1));
+}
+
+double Statistics::CalculateMAD(const float* values, int count, double averageValue)
 {
-    int count = weatherRecords.getCount();
     if (count == 0)
     {
         return 0.0;
@@ -127,10 +92,9 @@ double Statistics::CalculateMAD(
     double sumAbsoluteDifferences = 0.0;
     for (int i = 0; i < count; ++i)
     {
-        double value = GetValue(weatherRecords[i], dataType);
+        double value = values[i];
         sumAbsoluteDifferences += std::abs(value - averageValue);
     }
 
-    // MAD is the average of the absolute differences
     return sumAbsoluteDifferences / count;
 }
@@ -2,67 +2,55 @@
 #define STATISTICS_H_INCLUDED
 
 #include "Vector.h"
-#include "WeatherRecord.h"
-#include <string>
 #include <cmath>
 
 /**
  * @class Statistics
  * @brief Handles all statistical calculations for weather data.
- * * Provides static methods to calculate total, average, and sample standard
- * deviation for Wind Speed ('S'), Temperature ('T'), and Solar Radiation ('R').
+ * * Provides static methods to calculate total, average, sample standard deviation
+ * and MAD over a column of values, e.g. a month's wind speeds (see MonthColumns).
  */
 class Statistics
 {
 public:
     /**
-     * @brief Calculates the sum (total) of a specified data type.
-     * Parameter is const Vector<WeatherRecord>&
+     * @brief Calculates the sample Pearson Correlation Coefficient.
      */
-    static double CalculateTotal(const Vector<WeatherRecord>& weatherData, string dataType);
+    static double CalculateSPCC(const Vector<float>& dataX, const Vector<float>& dataY);
 
     /**
-     * @brief Calculates the arithmetic mean (average) of a specified data type.
-     * Parameter is const Vector<WeatherRecord>&
+     * @brief Calculates the sum (total) of a column of values.
+     * @param values The values (may be nullptr when count is 0).
+     * @param count The number of values.
+     * @return The total; 0 for no values.
      */
-    static double CalculateAverage(const Vector<WeatherRecord>& weatherData, string dataType);
+    static double CalculateTotal(const float* values, int count);
 
     /**
-     * @brief Calculates the sample standard deviation of a specified data type.
-     * Parameter is const Vector<WeatherRecord>&
-     */
-    static double CalculateStandardDeviation(
-        const Vector<WeatherRecord>& weatherData,
-        double averageValue,
-        string dataType
-    );
-    /**
-     * @brief Calculates the sample Pearson Correlation Coefficient.
+     * @brief Calculates the arithmetic mean (average) of a column of values.
+     * @param values The values.
+     * @param count The number of values.
+     * @return The average; 0 for no values.
      */
-    static double CalculateSPCC(const Vector<float>& dataX, const Vector<float>& dataY);
+    static double CalculateAverage(const float* values, int count);
 
     /**
-     * @brief Calculates the Mean Absolute Deviation (MAD) of a specified data type.
-     *
-     * @param weatherData The Vector containing the weather records.
-     * @param averageValue The pre-calculated average value of the data type.
-     * @param dataType A string code specifying the data type.
-     * @return The Mean Absolute Deviation.
+     * @brief Calculates the sample standard deviation of a column of values.
+     * @param values The values.
+     * @param count The number of values.
+     * @param averageValue The pre-calculated average of the values.
+     * @return The sample standard deviation; 0 for fewer than two values.
      */
-    static double CalculateMAD(
-        const Vector<WeatherRecord>& weatherData,
-        double averageValue,
-        string dataType
-    );
+    static double CalculateStandardDeviation(const float* values, int count, double averageValue);
 
-private:
     /**
-     * @brief Helper function to get the value of the specified data type from a single record.
-     * * @param record The single WeatherRecord object.
-     * @param dataType A string code specifying the data type.
-     * @return The float value of the requested data member.
+     * @brief Calculates the Mean Absolute Deviation (MAD) of a column of values.
+     * @param values The values.
+     * @param count The number of values.
+     * @param averageValue The pre-calculated average of the values.
+     * @return The Mean Absolute Deviation; 0 for no values.
      */
-    static float GetValue(const WeatherRecord& record, string dataType);
+    static double CalculateMAD(const float* values, int count, double averageValue);
 };
 
 #endif // STATISTICS_H_INCLUDED
@@ -0,0 +1,125 @@
+// Per-row cost of Controller::splitString versus CsvTokenizer + RecordParser.
+// Build (from the project folder), together with every project .cpp except main.cpp and the tests:
+//   g++ -std=c++17 -O2 TokenizerBenchmark.cpp Controller.cpp CsvTokenizer.cpp CsvScanner.cpp RecordParser.cpp ... -pthread
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include "Controller.h"
+#include "CsvTokenizer.h"
+#include "RecordParser.h"
+
+using namespace std;
+
+// Counts every heap allocation made by the program
+static long g_allocations = 0;
+
+void* operator new(size_t size)
+{
+    g_allocations++;
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+    {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+int main(int argc, char* argv[])
+{
+    string filename = (argc > 1) ? argv[1] : "data/Metdata-Jan-Dec2007.csv";
+    const int passes = 5;
+
+    cout << "--- Tokenizer Benchmark ---" << endl;
+
+    ifstream inFile(filename);
+    if (!inFile.is_open())
+    {
+        cout << "Could not open " << filename << endl;
+        return 1;
+    }
+
+    Vector<string> lines;
+    string line;
+    while (getline(inFile, line))
+    {
+        lines.Insert(line, lines.getCount());
+    }
+    int rows = lines.getCount();
+    cout << "Rows: " << rows << " from " << filename << endl;
+
+    Controller controller;
+    long tokenCount = 0;
+
+    // 1. Before: stringstream split into a Vector<string> per row
+    long allocationsBefore = g_allocations;
+    auto start = chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        for (int i = 0; i < rows; ++i)
+        {
+            Vector<string> tokens = controller.splitString(lines[i], ',');
+            tokenCount += tokens.getCount();
+        }
+    }
+    auto stop = chrono::steady_clock::now();
+    double splitNs = chrono::duration<double, nano>(stop - start).count() / (double(rows) * passes);
+    double splitAllocs = double(g_allocations - allocationsBefore) / (double(rows) * passes);
+
+    // 2. After: string_view tokenizer with a re-used field table
+    CsvTokenizer tokenizer(',');
+    allocationsBefore = g_allocations;
+    start = chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        for (int i = 0; i < rows; ++i)
+        {
+            tokenCount += tokenizer.Tokenize(lines[i]);
+        }
+    }
+    stop = chrono::steady_clock::now();
+    double tokenizeNs = chrono::duration<double, nano>(stop - start).count() / (double(rows) * passes);
+    double tokenizeAllocs = double(g_allocations - allocationsBefore) / (double(rows) * passes);
+
+    // 3. After, full row: tokenize and convert the WAST/S/T/SR fields
+    tokenizer.Tokenize(lines[0]);
+    ColumnLayout layout;
+    RecordParser::ResolveColumns(tokenizer, layout);
+    WeatherRecord record;
+    int parsedRows = 0;
+    allocationsBefore = g_allocations;
+    start = chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        for (int i = 1; i < rows; ++i)
+        {
+            tokenizer.Tokenize(lines[i]);
+            if (RecordParser::ParseRow(tokenizer, layout, record) == RowStatus::Ok)
+            {
+                parsedRows++;
+            }
+        }
+    }
+    stop = chrono::steady_clock::now();
+    double parseNs = chrono::duration<double, nano>(stop - start).count() / (double(rows) * passes);
+    double parseAllocs = double(g_allocations - allocationsBefore) / (double(rows) * passes);
+
+    cout << "splitString:            " << splitNs << " ns/row, " << splitAllocs << " allocations/row" << endl;
+    cout << "CsvTokenizer:           " << tokenizeNs << " ns/row, " << tokenizeAllocs << " allocations/row" << endl;
+    cout << "CsvTokenizer+ParseRow:  " << parseNs << " ns/row, " << parseAllocs << " allocations/row" << endl;
+    cout << "(checksum " << tokenCount << ", " << parsedRows << " rows parsed)" << endl;
+
+    cout << "\n--- End of Tokenizer Benchmark ---" << endl;
+    return 0;
+}
@@ -10,6 +10,7 @@
 
 using std::string;
 
+const string DATA_FOLDER = "data/";
 const char CSV_DELIMITER = ',';
 const char DATE_DELIMITER = '/';
 const char TIME_DELIMITER = ':';
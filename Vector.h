@@ -2,29 +2,56 @@
 #define VECTOR_H_INCLUDED
 
 #include <cassert>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 const int INITIAL_CAPACITY = 20;
 
-template <class T>
+/**
+ * @class Vector
+ * @brief Growable array of T.
+ *
+ * Storage is allocated uninitialised and elements are constructed in place,
+ * so only the first getCount() slots hold live objects and T does not need a
+ * default constructor. Appending (PushBack/EmplaceBack) is amortised O(1);
+ * growing moves the elements into the new block instead of copying them.
+ *
+ * Memory comes from Alloc, a standard-library style allocator; pass an
+ * ArenaAllocator to carve the storage out of an Arena.
+ */
+template <class T, class Alloc = std::allocator<T>>
 class Vector
 {
 public:
+    typedef Alloc allocator_type;
+
     /**
      * @brief Constructor for Vector with initial capacity.
      */
-    Vector(int initialCapacity);
+    Vector(int initialCapacity, const Alloc& allocator = Alloc());
 
     /**
      * @brief Default constructor for Vector.
-     * FIXED: Initializer list now matches declaration order.
      */
     Vector()
-        : m_vector(new T[INITIAL_CAPACITY]),
+        : m_allocator(),
+          m_vector(allocate(INITIAL_CAPACITY)),
+          m_capacity(INITIAL_CAPACITY),
+          m_count(0)
+    {
+    }
+
+    /**
+     * @brief Constructor for an empty Vector whose storage comes from the given allocator.
+     */
+    explicit Vector(const Alloc& allocator)
+        : m_allocator(allocator),
+          m_vector(allocate(INITIAL_CAPACITY)),
           m_capacity(INITIAL_CAPACITY),
           m_count(0)
     {
-        // Body is now empty
     }
 
     /**
@@ -33,25 +60,46 @@ public:
     ~Vector();
 
     /**
-     * @brief Copy constructor for Vector (Deep Copy Method 1).
-     * FIXED: Uses member initializer list and corrects copy bug.
+     * @brief Copy constructor for Vector (Deep Copy Method 1). Keeps the source's capacity and allocator.
      */
     Vector(const Vector& myVector)
-        : m_vector(new T[myVector.m_capacity]),
+        : m_allocator(std::allocator_traits<Alloc>::select_on_container_copy_construction(myVector.m_allocator)),
+          m_vector(allocate(myVector.m_capacity)),
           m_capacity(myVector.m_capacity),
-          m_count(myVector.m_count)
+          m_count(0)
     {
-        for (int i = 0; i < m_count; ++i)
+        for (int i = 0; i < myVector.m_count; ++i)
         {
-            m_vector[i] = myVector.m_vector[i]; // Corrected copy
+            new (m_vector + i) T(myVector.m_vector[i]);
+            m_count++;
         }
     }
 
     /**
-     * @brief Assignment operator for Vector (Deep Copy Method 2).
+     * @brief Move constructor for Vector. Takes over the storage; the source is left empty with no capacity.
+     */
+    Vector(Vector&& myVector) noexcept
+        : m_allocator(std::move(myVector.m_allocator)),
+          m_vector(myVector.m_vector),
+          m_capacity(myVector.m_capacity),
+          m_count(myVector.m_count)
+    {
+        myVector.m_vector = nullptr;
+        myVector.m_capacity = 0;
+        myVector.m_count = 0;
+    }
+
+    /**
+     * @brief Assignment operator for Vector (Deep Copy Method 2). Keeps this Vector's allocator.
      */
     Vector& operator=(const Vector& myVector);
 
+    /**
+     * @brief Move assignment operator for Vector. Releases the current elements and takes over the
+     * source's storage, or moves the elements one by one if the allocators differ and do not propagate.
+     */
+    Vector& operator=(Vector&& myVector);
+
     /**
      * @brief Access operator for Vector (const version - get element).
      */
@@ -67,11 +115,34 @@ public:
      */
     bool Insert(const T& data, int index);
 
+    /**
+     * @brief Appends a copy of data at the end.
+     */
+    void PushBack(const T& data);
+
+    /**
+     * @brief Appends data at the end, moving from it.
+     */
+    void PushBack(T&& data);
+
+    /**
+     * @brief Constructs a new element at the end from the given constructor arguments.
+     * @return The new element.
+     */
+    template <class... Args>
+    T& EmplaceBack(Args&&... args);
+
     /**
      * @brief Deletes the element at the specified index.
      */
     bool Delete(int index);
 
+    /**
+     * @brief Makes room for at least the given number of elements without further allocation.
+     * Never shrinks the Vector.
+     */
+    void Reserve(int capacity);
+
     /**
      * @brief Gets the number of elements currently in the Vector.
      */
@@ -82,27 +153,49 @@ public:
      */
     int getCapacity() const;
 
+    /**
+     * @brief Gets the allocator the storage comes from.
+     */
+    const Alloc& GetAllocator() const;
+
 private:
-    // ---
-    // This is the declaration order the compiler uses:
-    // 1. m_vector
-    // 2. m_capacity
-    // 3. m_count
-    // ---
-    T* m_vector;      //!< Pointer to the dynamically allocated array of elements.
+    Alloc m_allocator; //!< Source of the storage.
+    T* m_vector;      //!< Storage for m_capacity elements; the first m_count are constructed.
     int m_capacity;  //!< The current allocated size of the m_vector array.
     int m_count;     //!< The number of elements currently stored in the vector.
 
+    T* allocate(int capacity);
+    void deallocate(T* storage, int capacity);
+
+    /**
+     * @brief Destroys every element, keeping the storage.
+     */
+    void destroyAll();
+
     /**
-     * @brief Resizes the internal array to double its capacity.
+     * @brief Moves the elements into a new block of the given capacity.
      */
-    void Resize();
+    void reallocate(int newCapacity);
 };
 
-// --- (Rest of the file is unchanged) ---
+template <class T, class Alloc>
+T* Vector<T, Alloc>::allocate(int capacity)
+{
+    return std::allocator_traits<Alloc>::allocate(m_allocator, static_cast<size_t>(capacity));
+}
+
+template <class T, class Alloc>
+void Vector<T, Alloc>::deallocate(T* storage, int capacity)
+{
+    if (storage != nullptr)
+    {
+        std::allocator_traits<Alloc>::deallocate(m_allocator, storage, static_cast<size_t>(capacity));
+    }
+}
 
-template <class T>
-Vector<T>::Vector(int initialCapacity)
+template <class T, class Alloc>
+Vector<T, Alloc>::Vector(int initialCapacity, const Alloc& allocator)
+    : m_allocator(allocator)
 {
     if (initialCapacity > 0)
     {
@@ -113,51 +206,88 @@ Vector<T>::Vector(int initialCapacity)
         m_capacity = INITIAL_CAPACITY;
     }
 
-    // FIXED: Match declaration order in list
-    m_vector = new T[m_capacity];
+    m_vector = allocate(m_capacity);
     m_count = 0;
-
-    if (m_vector == nullptr)
-    {
-        m_capacity = 0;
-    }
 }
 
-template <class T>
-Vector<T>::~Vector()
+template <class T, class Alloc>
+Vector<T, Alloc>::~Vector()
 {
-    delete[] m_vector;
+    destroyAll();
+    deallocate(m_vector, m_capacity);
     m_vector = nullptr;
 }
 
 // Deep Copy Method 2: Assignment Operator
-template <class T>
-Vector<T>& Vector<T>::operator = (const Vector& myVector)
+template <class T, class Alloc>
+Vector<T, Alloc>& Vector<T, Alloc>::operator = (const Vector& myVector)
 {
     if (this == &myVector)
     {
         return *this;
     }
 
+    destroyAll();
+
     // Check if current capacity is enough; if not, reallocate
     if (m_capacity < myVector.m_count)
     {
-        delete[] m_vector;
+        deallocate(m_vector, m_capacity);
+        m_vector = nullptr;
+        m_capacity = 0;
+        m_vector = allocate(myVector.m_capacity);
         m_capacity = myVector.m_capacity;
-        m_vector = new T[m_capacity];
     }
 
-    m_count = myVector.m_count;
-    for (int i = 0; i < m_count; ++i)
+    for (int i = 0; i < myVector.m_count; ++i)
+    {
+        new (m_vector + i) T(myVector.m_vector[i]);
+        m_count++;
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+Vector<T, Alloc>& Vector<T, Alloc>::operator = (Vector&& myVector)
+{
+    if (this == &myVector)
+    {
+        return *this;
+    }
+
+    destroyAll();
+    if (!std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value
+            && !(m_allocator == myVector.m_allocator))
+    {
+        // The source's storage belongs to a different allocator: move the elements instead
+        Reserve(myVector.m_count);
+        for (int i = 0; i < myVector.m_count; ++i)
+        {
+            new (m_vector + i) T(std::move(myVector.m_vector[i]));
+            m_count++;
+        }
+        myVector.destroyAll();
+        return *this;
+    }
+
+    deallocate(m_vector, m_capacity);
+    if (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value)
     {
-        m_vector[i] = myVector.m_vector[i];
+        m_allocator = std::move(myVector.m_allocator);
     }
+
+    m_vector = myVector.m_vector;
+    m_capacity = myVector.m_capacity;
+    m_count = myVector.m_count;
+    myVector.m_vector = nullptr;
+    myVector.m_capacity = 0;
+    myVector.m_count = 0;
     return *this;
 }
 
 // Access operator (const version - get element)
-template <class T>
-const T& Vector<T>::operator[](int index) const
+template <class T, class Alloc>
+const T& Vector<T, Alloc>::operator[](int index) const
 {
     if (index < 0 || index >= m_count)
     {
@@ -167,8 +297,8 @@ const T& Vector<T>::operator[](int index) const
 }
 
 // Access operator (non-const version - modify element)
-template <class T>
-T& Vector<T>::operator[](int index)
+template <class T, class Alloc>
+T& Vector<T, Alloc>::operator[](int index)
 {
     if (index < 0 || index >= m_count)
     {
@@ -178,80 +308,148 @@ T& Vector<T>::operator[](int index)
 }
 
 // Insert at specific index
-template <class T>
-bool Vector<T>::Insert(const T& data, int index)
+template <class T, class Alloc>
+bool Vector<T, Alloc>::Insert(const T& data, int index)
 {
     if (index < 0 || index > m_count)
     {
         return false;
     }
 
-    if (m_count == m_capacity)
+    if (index == m_count)
     {
-        Resize();
+        EmplaceBack(data);
+        return true;
     }
 
-    for (int i = m_count; i > index; --i)
+    // data may be one of our own elements, which the shift below would overwrite
+    T value(data);
+    EmplaceBack(std::move(m_vector[m_count - 1]));
+    for (int i = m_count - 2; i > index; --i)
     {
-        m_vector[i] = m_vector[i - 1];
+        m_vector[i] = std::move(m_vector[i - 1]);
     }
 
-    m_vector[index] = data;
-    m_count++;
+    m_vector[index] = std::move(value);
     return true;
 }
 
-// Delete at specific index (add)
-template <class T>
-bool Vector<T>::Delete(int index)
+template <class T, class Alloc>
+void Vector<T, Alloc>::PushBack(const T& data)
 {
-    if (index < 0 || index >= m_count)
+    EmplaceBack(data);
+}
+
+template <class T, class Alloc>
+void Vector<T, Alloc>::PushBack(T&& data)
+{
+    EmplaceBack(std::move(data));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+T& Vector<T, Alloc>::EmplaceBack(Args&&... args)
+{
+    if (m_count == m_capacity)
     {
-        return false;
+        // Build the new element first: args may refer to an element of the old block
+        int newCapacity = (m_capacity * 2 < 1) ? INITIAL_CAPACITY : m_capacity * 2;
+        T* newVector = allocate(newCapacity);
+        try
+        {
+            new (newVector + m_count) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocate(newVector, newCapacity);
+            throw;
+        }
+
+        for (int i = 0; i < m_count; ++i)
+        {
+            new (newVector + i) T(std::move(m_vector[i]));
+            m_vector[i].~T();
+        }
+        deallocate(m_vector, m_capacity);
+        m_vector = newVector;
+        m_capacity = newCapacity;
+    }
+    else
+    {
+        new (m_vector + m_count) T(std::forward<Args>(args)...);
     }
 
-    if (m_count == 0)
+    return m_vector[m_count++];
+}
+
+// Delete at specific index (add)
+template <class T, class Alloc>
+bool Vector<T, Alloc>::Delete(int index)
+{
+    if (index < 0 || index >= m_count)
     {
         return false;
     }
 
     for (int i = index; i < m_count - 1; ++i)
     {
-        m_vector[i] = m_vector[i + 1];
+        m_vector[i] = std::move(m_vector[i + 1]);
     }
 
     m_count--;
+    m_vector[m_count].~T();
     return true;
 }
 
+template <class T, class Alloc>
+void Vector<T, Alloc>::Reserve(int capacity)
+{
+    if (capacity > m_capacity)
+    {
+        reallocate(capacity);
+    }
+}
 
-template <class T>
-int Vector<T>::getCount() const
+template <class T, class Alloc>
+int Vector<T, Alloc>::getCount() const
 {
     return m_count;
 }
 
-template <class T>
-int Vector<T>::getCapacity() const
+template <class T, class Alloc>
+int Vector<T, Alloc>::getCapacity() const
 {
     return m_capacity;
 }
 
-template <class T>
-void Vector<T>::Resize()
+template <class T, class Alloc>
+const Alloc& Vector<T, Alloc>::GetAllocator() const
+{
+    return m_allocator;
+}
+
+template <class T, class Alloc>
+void Vector<T, Alloc>::destroyAll()
 {
-    int newCapacity = m_capacity * 2;
-    if (newCapacity < 1)
-        newCapacity = INITIAL_CAPACITY;
+    for (int i = 0; i < m_count; ++i)
+    {
+        m_vector[i].~T();
+    }
+    m_count = 0;
+}
 
-    T* newVector = new T[newCapacity];
+template <class T, class Alloc>
+void Vector<T, Alloc>::reallocate(int newCapacity)
+{
+    T* newVector = allocate(newCapacity);
 
     for (int i = 0; i < m_count; ++i)
     {
-        newVector[i] = m_vector[i];
+        new (newVector + i) T(std::move(m_vector[i]));
+        m_vector[i].~T();
     }
 
-    delete[] m_vector;
+    deallocate(m_vector, m_capacity);
     m_vector = newVector;
     m_capacity = newCapacity;
 }
@@ -1,9 +1,19 @@
 #include <iostream>
 #include <cassert> // For assertions (assert)
+#include <string>
+#include <utility>
 #include "Vector.h" // Include the Vector class definition
 
 using namespace std;
 
+// Element type that can only be built from arguments
+struct NoDefault
+{
+    NoDefault(int i, const string& n) : id(i), name(n) {}
+    int id;
+    string name;
+};
+
 int main()
 {
     cout << "--- Vector Class Unit Tests ---" << endl;
@@ -25,7 +35,7 @@ int main()
     // 2. Insert Test - Initial Insert and Count
     cout << "\n--- Insert Test - Initial ---" << endl;
     Vector<int> insertVector;
-    insertVector.insert(10);
+    insertVector.PushBack(10);
     cout << "Vector Count after insert(10): " << insertVector.getCount() << endl;
     cout << "Vector Capacity after insert(10): " << insertVector.getCapacity() << endl;
     cout << "Element at index 0: " << insertVector[0] << endl;
@@ -44,7 +54,7 @@ int main()
     int initialCapacity = resizeVector.getCapacity();
     for (int i = 1; i <= initialCapacity + 2; ++i)   // Insert more than initial capacity to force resize
     {
-        resizeVector.insert(i * 5);
+        resizeVector.PushBack(i * 5);
     }
     cout << "Vector Count after multiple inserts: " << resizeVector.getCount() << endl;
     cout << "Vector Capacity after multiple inserts (resized): " << resizeVector.getCapacity() << endl;
@@ -67,8 +77,8 @@ int main()
     // 4. Copy Constructor Test
     cout << "\n--- Copy Constructor Test ---" << endl;
     Vector<int> originalVector;
-    originalVector.insert(20);
-    originalVector.insert(30);
+    originalVector.PushBack(20);
+    originalVector.PushBack(30);
     Vector<int> copyVector = originalVector; // Copy constructor called
     cout << "Copy Vector Count: " << copyVector.getCount() << endl;
     cout << "Copy Vector Capacity: " << copyVector.getCapacity() << endl;
@@ -102,8 +112,8 @@ int main()
     // 5. Assignment Operator Test
     cout << "\n--- Assignment Operator Test ---" << endl;
     Vector<int> assignVector1;
-    assignVector1.insert(40);
-    assignVector1.insert(50);
+    assignVector1.PushBack(40);
+    assignVector1.PushBack(50);
     Vector<int> assignVector2;
     assignVector2 = assignVector1; // Assignment operator called
     cout << "Assigned Vector Count: " << assignVector2.getCount() << endl;
@@ -136,7 +146,7 @@ int main()
     // 6. Self-Assignment Test (should not crash or corrupt data)
     cout << "\n--- Self-Assignment Test ---" << endl;
     Vector<int> selfAssignVector;
-    selfAssignVector.insert(60);
+    selfAssignVector.PushBack(60);
     selfAssignVector = selfAssignVector; // Self-assignment
     cout << "Vector after self-assignment Count: " << selfAssignVector.getCount() << endl;
     cout << "Vector after self-assignment Capacity: " << selfAssignVector.getCapacity() << endl;
@@ -168,7 +178,7 @@ int main()
     Vector<int> countTestVector;
     for (int i = 0; i < 5; ++i)
     {
-        countTestVector.insert(i + 100);
+        countTestVector.PushBack(i + 100);
     }
     cout << "getCount() should be 5, actual: " << countTestVector.getCount() << endl;
     if (countTestVector.getCount() == 5)
@@ -185,7 +195,7 @@ int main()
     Vector<int> capacityTestVector;
     cout << "Initial getCapacity(): " << capacityTestVector.getCapacity() << endl;
     int capacityBeforeInsert = capacityTestVector.getCapacity();
-    capacityTestVector.insert(1);
+    capacityTestVector.PushBack(1);
     cout << "getCapacity() after one insert (should be same or larger): " << capacityTestVector.getCapacity() << endl;
     if (capacityTestVector.getCapacity() >= capacityBeforeInsert)
     {
@@ -196,6 +206,89 @@ int main()
         cout << "getCapacity() Test - Direct: FAILED" << endl;
     }
 
+    // 10. Move Constructor / Assignment Test
+    cout << "\n--- Move Test ---" << endl;
+    Vector<string> moveSource;
+    moveSource.PushBack("alpha");
+    moveSource.PushBack("beta");
+    Vector<string> movedVector(std::move(moveSource));
+    Vector<string> moveAssigned;
+    moveAssigned.PushBack("gamma");
+    moveAssigned = std::move(movedVector);
+    if (moveAssigned.getCount() == 2 && moveAssigned[1] == "beta" && movedVector.getCount() == 0 &&
+            moveSource.getCount() == 0)
+    {
+        cout << "Move Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Move Test: FAILED" << endl;
+    }
+
+    // A moved-from Vector is empty but still usable
+    moveSource.PushBack("delta");
+    if (moveSource.getCount() == 1 && moveSource[0] == "delta")
+    {
+        cout << "Moved-From Reuse Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Moved-From Reuse Test: FAILED" << endl;
+    }
+
+    // 11. Reserve Test
+    cout << "\n--- Reserve Test ---" << endl;
+    Vector<int> reserveVector;
+    reserveVector.Reserve(1000);
+    int reservedCapacity = reserveVector.getCapacity();
+    for (int i = 0; i < 1000; ++i)
+    {
+        reserveVector.PushBack(i);
+    }
+    reserveVector.Reserve(10); // Never shrinks
+    if (reservedCapacity >= 1000 && reserveVector.getCapacity() == reservedCapacity && reserveVector[999] == 999)
+    {
+        cout << "Reserve Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Reserve Test: FAILED" << endl;
+    }
+
+    // 12. EmplaceBack Test - element type without a default constructor
+    cout << "\n--- EmplaceBack Test ---" << endl;
+    Vector<NoDefault> emplaceVector(2);
+    for (int i = 0; i < 5; ++i)
+    {
+        emplaceVector.EmplaceBack(i, "item");
+    }
+    if (emplaceVector.getCount() == 5 && emplaceVector[4].id == 4 && emplaceVector[4].name == "item")
+    {
+        cout << "EmplaceBack Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "EmplaceBack Test: FAILED" << endl;
+    }
+
+    // 13. Insert / Delete in the middle, including inserting one of the Vector's own elements
+    cout << "\n--- Insert Middle Test ---" << endl;
+    Vector<string> middleVector(2);
+    middleVector.PushBack("a");
+    middleVector.PushBack("c");
+    middleVector.PushBack("d");
+    middleVector.Insert("b", 1);
+    middleVector.Insert(middleVector[3], 0); // Forces a resize while data points into the Vector
+    middleVector.Delete(1);
+    if (middleVector.getCount() == 4 && middleVector[0] == "d" && middleVector[1] == "b" &&
+            middleVector[2] == "c" && middleVector[3] == "d")
+    {
+        cout << "Insert Middle Test: PASSED" << endl;
+    }
+    else
+    {
+        cout << "Insert Middle Test: FAILED" << endl;
+    }
 
     cout << "\n--- End of Vector Class Unit Tests ---" << endl;
 
@@ -5,47 +5,71 @@ void WeatherDatabase::Insert(const WeatherRecord& record)
     const Date& date = record.GetDate();
     int year = date.GetYear();
     int month = date.GetMonth();
-    int day = date.GetDay();
 
-    // 1. Find or Create Year
-    YearData searchYear;
-    searchYear.year = year;
-    YearData* yearNode = m_yearTree.Search(searchYear);
-
-    if (yearNode == nullptr)
+    // 0. Duplicate check: one hash lookup and one bit test
+    bool duplicate = false;
+    if (m_duplicatePolicy != DuplicatePolicy::KeepAll && m_duplicates.TestAndSet(date, record.GetTime()))
     {
-        // Year doesn't exist, create it and insert it
-        m_yearTree.Insert(searchYear);
-        // find the node that was just inserted
-        yearNode = m_yearTree.Search(searchYear);
+        duplicate = true;
+        m_duplicateCount++;
+        if (m_duplicatePolicy == DuplicatePolicy::FirstWins)
+        {
+            return;
+        }
     }
 
+    // 1. Find or Create Year (one descent; the YearData is only built if the year is new)
+    YearData* yearNode = m_yearTree.FindOrInsert(year, year, m_arena);
+
     // 2. Find or Create Month
-    MonthData searchMonth;
-    searchMonth.month = month;
-    MonthData* monthNode = yearNode->monthTree.Search(searchMonth);
+    MonthData* monthNode = yearNode->monthTree.FindOrInsert(month, year, month, m_arena);
 
-    if (monthNode == nullptr)
+    // 3. Add the record to the month's columns, after the other records of its day
+    // Overwrite the stored copy instead; a day holds at most one record per minute here
+    if (duplicate && m_duplicatePolicy == DuplicatePolicy::LastWins && monthNode->columns.Replace(record))
     {
-        // Month doesn't exist for this year, create and insert it
-        yearNode->monthTree.Insert(searchMonth);
-        // find the node that was just inserted
-        monthNode = yearNode->monthTree.Search(searchMonth);
+        // Replaced in place, so the record count does not change
+        return;
     }
+    monthNode->columns.Append(record);
+    m_recordCount++;
+}
 
-    // 3. Insert Record into Day Map
-    // std::map operator[] auto-creates the Vector<WeatherRecord> if the day doesn't exist.
-    // We then Insert the record at the end of that day's vector.
-    Vector<WeatherRecord>& dayVector = monthNode->dayData[day];
-    dayVector.Insert(record, dayVector.getCount());
+void WeatherDatabase::FinishLoading()
+{
+    m_yearTree.InOrder([](YearData& yearData) { yearData.monthTree.Rebalance(); });
+    m_yearTree.Rebalance();
 }
 
-const DayMap* WeatherDatabase::GetMonthData(int y, int m) const
+void WeatherDatabase::SetDuplicatePolicy(DuplicatePolicy policy)
+{
+    m_duplicatePolicy = policy;
+}
+
+DuplicatePolicy WeatherDatabase::GetDuplicatePolicy() const
+{
+    return m_duplicatePolicy;
+}
+
+long WeatherDatabase::GetDuplicateCount() const
+{
+    return m_duplicateCount;
+}
+
+void WeatherDatabase::AddDroppedDuplicates(long count)
+{
+    m_duplicateCount += count;
+}
+
+long WeatherDatabase::GetRecordCount() const
+{
+    return m_recordCount;
+}
+
+const MonthColumns* WeatherDatabase::GetMonthData(int y, int m) const
 {
     // 1. Find Year
-    YearData searchYear;
-    searchYear.year = y;
-    const YearData* yearNode = m_yearTree.Search(searchYear);
+    const YearData* yearNode = m_yearTree.Find(y);
 
     if (yearNode == nullptr)
     {
@@ -53,17 +77,31 @@ const DayMap* WeatherDatabase::GetMonthData(int y, int m) const
     }
 
     // 2. Find Month
-    MonthData searchMonth;
-    searchMonth.month = m;
-    const MonthData* monthNode = yearNode->monthTree.Search(searchMonth);
+    const MonthData* monthNode = yearNode->monthTree.Find(m);
 
     if (monthNode == nullptr)
     {
         return nullptr; // Month not found
     }
 
-    // 3. Return pointer to the DayMap
-    return &(monthNode->dayData);
+    // 3. Return pointer to the month's columns
+    return &(monthNode->columns);
+}
+
+YearTree::ConstRange WeatherDatabase::GetYears(int firstYear, int lastYear) const
+{
+    return m_yearTree.GetRange(firstYear, lastYear);
+}
+
+MonthTree::ConstRange WeatherDatabase::GetMonths(int y, int firstMonth, int lastMonth) const
+{
+    const YearData* yearNode = m_yearTree.Find(y);
+
+    if (yearNode == nullptr)
+    {
+        return MonthTree::ConstRange(); // Year not found
+    }
+    return yearNode->monthTree.GetRange(firstMonth, lastMonth);
 }
 
 void WeatherDatabase::TraverseYears(visit_t<YearData> visit_func, void* userData)
@@ -71,3 +109,18 @@ void WeatherDatabase::TraverseYears(visit_t<YearData> visit_func, void* userData
     // Delegate to the BST's InOrder traversal
     m_yearTree.InOrder(visit_func, userData);
 }
+
+void WeatherDatabase::Merge(const WeatherDatabase& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+    other.TraverseYears([this](const YearData& yearData)
+    {
+        yearData.monthTree.InOrder([this](const MonthData& monthData)
+        {
+            monthData.columns.ForEachRecord([this](const WeatherRecord& record) { Insert(record); });
+        });
+    });
+}
@@ -4,9 +4,26 @@
 #include "Bst.h"
 #include "WeatherRecord.h"
 #include "Vector.h"
-#include <map>
+#include "DuplicateIndex.h"
+#include "Arena.h"
+#include "MonthColumns.h"
+#ifdef WEATHERDATABASE_EYTZINGER_INDEX
+#include "EytzingerSet.h"
+#endif
 
-using DayMap = std::map<int, Vector<WeatherRecord>>;
+/**
+ * @brief Ordered container behind the year and month indexes.
+ * Defaults to an AVL Bst; build with -DWEATHERDATABASE_EYTZINGER_INDEX to use
+ * EytzingerSet instead (contiguous storage and branchless lookups, but pointers
+ * to years and months only stay valid until the next year or month is added).
+ */
+#ifdef WEATHERDATABASE_EYTZINGER_INDEX
+template <class T>
+using DatabaseIndex = EytzingerSet<T, ArenaAllocator<T>>;
+#else
+template <class T>
+using DatabaseIndex = Bst<T, ArenaAllocator<T>, BstBalance::Avl>;
+#endif
 
 /**
  * @struct MonthData
@@ -14,26 +31,27 @@ using DayMap = std::map<int, Vector<WeatherRecord>>;
  */
 struct MonthData
 {
-    MonthData() : month(0), dayData() {}
+    MonthData() : month(0), columns() {}
+    MonthData(int y, int m, Arena* arena) : month(m), columns(y, m, arena) {}
 
     int month = 0;
-    DayMap dayData; // Map of <Day_Number, Vector_Of_Records_For_That_Day>
+    MonthColumns columns; // Every record of the month: one array per sensor, grouped by day
+};
 
-    // Required operators for Bst<MonthData>
-    bool operator<(const MonthData& other) const
-    {
-        return month < other.month;
-    }
-    bool operator>(const MonthData& other) const
-    {
-        return month > other.month;
-    }
-    bool operator==(const MonthData& other) const
+/// @brief Month trees are ordered and searched by the bare month number.
+template <>
+struct BstKey<MonthData>
+{
+    typedef int KeyType;
+    static int Get(const MonthData& item)
     {
-        return month == other.month;
+        return item.month;
     }
 };
 
+/// @brief The months of one year, ordered by month number.
+using MonthTree = DatabaseIndex<MonthData>;
+
 /**
  * @struct YearData
  * @brief Stores all data for a single year, held within the main BST.
@@ -41,51 +59,123 @@ struct MonthData
 struct YearData
 {
     YearData() : year(0), monthTree() {}
+    YearData(int y, Arena* arena) : year(y), monthTree(ArenaAllocator<MonthData>(arena)) {}
 
     int year = 0;
-    Bst<MonthData> monthTree; // A BST of all months for this year
+    MonthTree monthTree; // A BST of all months for this year
+};
 
-    // Required operators for Bst<YearData>
-    bool operator<(const YearData& other) const
-    {
-        return year < other.year;
-    }
-    bool operator>(const YearData& other) const
-    {
-        return year > other.year;
-    }
-    bool operator==(const YearData& other) const
+/// @brief The year tree is ordered and searched by the bare year.
+template <>
+struct BstKey<YearData>
+{
+    typedef int KeyType;
+    static int Get(const YearData& item)
     {
-        return year == other.year;
+        return item.year;
     }
 };
 
+/// @brief The years of a database, ordered by year.
+using YearTree = DatabaseIndex<YearData>;
+
 
 /**
  * @class WeatherDatabase
  * @brief Encapsulates the Year->Month->Day nested data structure.
  *
  * This class provides efficient insertion and query methods for the menu options.
+ * Built with an Arena, every tree node and month column is carved
+ * out of the arena's blocks, so loading makes a handful of large allocations
+ * and the memory is given back in one go when the arena is released.
  */
 class WeatherDatabase
 {
 public:
-    WeatherDatabase() : m_yearTree() {}
+    WeatherDatabase()
+        : m_arena(nullptr), m_yearTree(), m_duplicatePolicy(DuplicatePolicy::KeepAll), m_duplicates(),
+          m_duplicateCount(0), m_recordCount(0) {}
+
+    /**
+     * @brief Creates an empty database whose storage comes from an arena.
+     * @param arena The arena; it must outlive the database (nullptr: use the heap).
+     */
+    explicit WeatherDatabase(Arena* arena)
+        : m_arena(arena), m_yearTree(ArenaAllocator<YearData>(arena)), m_duplicatePolicy(DuplicatePolicy::KeepAll),
+          m_duplicates(), m_duplicateCount(0), m_recordCount(0) {}
     ~WeatherDatabase() = default;
 
     /**
      * @brief Inserts a single weather record into the nested data structure.
+     * A record whose date and minute are already stored is handled according to
+     * the duplicate policy (see SetDuplicatePolicy).
      * @param record The WeatherRecord to add.
      */
     void Insert(const WeatherRecord& record);
 
     /**
-     * @brief Retrieves the map of day-data for a specific month and year.
+     * @brief Rebalances the year tree and every month tree once a batch of inserts is done.
+     * Only links are changed, so pointers into the database stay valid.
+     */
+    void FinishLoading();
+
+    /**
+     * @brief Sets how Insert (and Merge) treat records with an already stored timestamp.
+     * Set it before loading; records inserted earlier are not indexed.
+     * @param policy DuplicatePolicy::KeepAll (default), FirstWins, LastWins or Flag.
+     */
+    void SetDuplicatePolicy(DuplicatePolicy policy);
+
+    /**
+     * @brief Gets the duplicate policy.
+     * @return The active DuplicatePolicy.
+     */
+    DuplicatePolicy GetDuplicatePolicy() const;
+
+    /**
+     * @brief Gets the number of inserted records that repeated a stored timestamp.
+     * @return The duplicates dropped, replaced or flagged so far (0 with KeepAll).
+     */
+    long GetDuplicateCount() const;
+
+    /**
+     * @brief Counts duplicates that were dropped before the records reached this database,
+     * e.g. by the load that wrote a RecordCache.
+     * @param count The number of dropped duplicates to add to GetDuplicateCount.
+     */
+    void AddDroppedDuplicates(long count);
+
+    /**
+     * @brief Gets the number of records stored.
+     * @return The records kept, i.e. without dropped or replaced duplicates.
+     */
+    long GetRecordCount() const;
+
+    /**
+     * @brief Retrieves the records of a specific month and year.
      * @param y The year to search for.
      * @param m The month to search for.
-     * @return A const pointer to the DayMap, or nullptr if no data exists.
+     * @return A const pointer to the month's columns, or nullptr if no data exists.
      */
-    const DayMap* GetMonthData(int y, int m) const;
+    const MonthColumns* GetMonthData(int y, int m) const;
+
+    /**
+     * @brief Gets the years with data from firstYear to lastYear inclusive, in order.
+     * Only the years in range are visited when iterating, e.g. for (const YearData& y : db.GetYears(2010, 2014)).
+     * @param firstYear The first year wanted.
+     * @param lastYear The last year wanted.
+     * @return The range of YearData (empty if none are stored).
+     */
+    YearTree::ConstRange GetYears(int firstYear, int lastYear) const;
+
+    /**
+     * @brief Gets the months of a year with data from firstMonth to lastMonth inclusive, in order.
+     * @param y The year.
+     * @param firstMonth The first month wanted (1-12).
+     * @param lastMonth The last month wanted (1-12).
+     * @return The range of MonthData (empty if the year or months are not stored).
+     */
+    MonthTree::ConstRange GetMonths(int y, int firstMonth, int lastMonth) const;
 
     /**
      * @brief Traverses the Year BST, calling the visit function on each YearData.
@@ -95,8 +185,33 @@ public:
      */
     void TraverseYears(visit_t<YearData> visit_func, void* userData);
 
+    /**
+     * @brief Traverses the years in order without modifying them, calling visit(yearData) on each.
+     * @param visit Any callable taking const YearData& (e.g. a capturing lambda); returning false stops early.
+     * @return false if the visitor stopped the traversal early, true otherwise.
+     */
+    template <class Visitor>
+    bool TraverseYears(Visitor&& visit) const
+    {
+        return m_yearTree.InOrder(std::forward<Visitor>(visit));
+    }
+
+    /**
+     * @brief Appends every record of another database to this one.
+     * Records are visited in year, month, day and then original insertion order, so
+     * merging per-file partial databases in file order reproduces the same per-day
+     * record order as loading those files one after another.
+     * @param other The database to copy records from.
+     */
+    void Merge(const WeatherDatabase& other);
+
 private:
-    Bst<YearData> m_yearTree;
+    Arena* m_arena;                    //!< Source of the tree's memory (nullptr: the heap).
+    YearTree m_yearTree;               //!< Balanced: years arrive in sorted order.
+    DuplicatePolicy m_duplicatePolicy; //!< Treatment of repeated timestamps.
+    DuplicateIndex m_duplicates;       //!< Timestamps inserted so far (unused with KeepAll).
+    long m_duplicateCount;             //!< Duplicates seen so far.
+    long m_recordCount;                //!< Records stored in the day vectors.
 };
 
 #endif // WEATHERDATABASE_H_INCLUDED
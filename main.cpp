@@ -1,22 +1,149 @@
 #include "Controller.h"
 #include "Types.h"
 #include "Menu.h"
+#include "RecordSource.h"
+#include "RecordSink.h"
+#include "FileFollower.h"
 #include <limits>
+#include <cstring>
+#include <cstdlib>
 
-int main()
+int main(int argc, char* argv[])
 {
     // 0. Data store
     Controller weatherController;
     Menu weatherMenu;
-    WeatherDatabase weatherDatabase;
+    Arena databaseArena; // Holds every node and record array of the database
+    WeatherDatabase weatherDatabase(&databaseArena);
     const string filename = "data/data_source.txt";
+    const string cacheFilename = "data/weather.cache";
+    bool useCache = true;
+    bool summary = false;
+    const char* sensorList = nullptr;
+    bool follow = false;
+
+    // Optional loader settings, e.g. "Weather --mmap --threads 4"
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--mmap") == 0)
+        {
+            weatherController.SetLoadMode(LoadMode::Mapped);
+        }
+        else if (strcmp(argv[i], "--pipeline") == 0)
+        {
+            weatherController.SetLoadMode(LoadMode::Pipelined);
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            weatherController.SetLoaderThreads(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--chunk-threads") == 0 && i + 1 < argc)
+        {
+            weatherController.SetChunkThreads(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--dedup") == 0 && i + 1 < argc)
+        {
+            // Treatment of rows repeated across overlapping files: first, last or flag
+            const char* policy = argv[++i];
+            if (strcmp(policy, "first") == 0)
+            {
+                weatherDatabase.SetDuplicatePolicy(DuplicatePolicy::FirstWins);
+            }
+            else if (strcmp(policy, "last") == 0)
+            {
+                weatherDatabase.SetDuplicatePolicy(DuplicatePolicy::LastWins);
+            }
+            else if (strcmp(policy, "flag") == 0)
+            {
+                weatherDatabase.SetDuplicatePolicy(DuplicatePolicy::Flag);
+            }
+            else
+            {
+                cerr << "Unknown duplicate policy: " << policy << " (use first, last or flag)" << endl;
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--follow") == 0)
+        {
+            follow = true;
+        }
+        else if (strcmp(argv[i], "--no-cache") == 0)
+        {
+            useCache = false;
+        }
+        else if (strcmp(argv[i], "--summary") == 0)
+        {
+            summary = true;
+        }
+        else if (strcmp(argv[i], "--sensors") == 0 && i + 1 < argc)
+        {
+            sensorList = argv[++i];
+        }
+    }
+
+    // One-pass monthly report streamed from the CSVs; no database is built
+    if (summary)
+    {
+        SourceListRecordSource source(filename);
+        MonthlyStatsSink monthlyStats;
+        if (PumpRecords(source, monthlyStats) < 0)
+        {
+            return 1;
+        }
+        monthlyStats.Print(cout);
+        source.GetReport().Print(cerr);
+        return 0;
+    }
+
+    // Monthly averages of the listed columns only, e.g. "--sensors RH,QFE"
+    if (sensorList != nullptr)
+    {
+        SensorSchema schema;
+        if (!SensorSchema::ParseList(sensorList, schema))
+        {
+            cerr << "Unknown sensor in list: " << sensorList << endl;
+            return 1;
+        }
+        SensorFrame frame(schema);
+        if (weatherController.LoadAllSensorColumnsFromSourceFile(frame, filename) < 0)
+        {
+            return 1;
+        }
+        weatherMenu.DisplaySensorAverages(frame);
+        return 0;
+    }
+
+    // Follow mode: a last line without its newline is left for the follower, and the CSVs are
+    // always parsed since the cache does not record where each file's complete lines end
+    if (follow)
+    {
+        weatherController.SetSkipUnfinishedLine(true);
+        useCache = false;
+    }
 
     // 1. Input / Load
-    int recordsCount = weatherController.LoadAllRecordsFromSourceFile(weatherDatabase, filename);
+    IngestReport loadReport;
+    int recordsCount = useCache
+                       ? weatherController.LoadAllRecordsCached(weatherDatabase, filename, cacheFilename)
+                       : weatherController.LoadAllRecordsFromSourceFile(weatherDatabase, filename, loadReport);
+    if (loadReport.getCount() > 0)
+    {
+        loadReport.Print(cerr);
+    }
 
     if (recordsCount > 0)
     {
-        cout << "Successfully loaded " << recordsCount << " weather records." << endl;
+        // Report what was kept, so a fresh parse and a cached load print the same line
+        cout << "Successfully loaded " << weatherDatabase.GetRecordCount() << " weather records";
+        if (weatherDatabase.GetDuplicateCount() > 0)
+        {
+            DuplicatePolicy policy = weatherDatabase.GetDuplicatePolicy();
+            cout << " (" << weatherDatabase.GetDuplicateCount()
+                 << (policy == DuplicatePolicy::Flag ? " duplicates flagged"
+                     : policy == DuplicatePolicy::LastWins ? " duplicates replaced" : " duplicates dropped")
+                 << ": same date and minute as an earlier row)";
+        }
+        cout << "." << endl;
     }
     else
     {
@@ -25,10 +152,28 @@ int main()
     }
 
 
+    // Follow mode: rows appended to the listed files are loaded before each menu
+    FileFollower follower;
+    if (follow)
+    {
+        int followed = follower.WatchLoadedFiles(loadReport);
+        cout << "Following " << followed << " data files for new rows"
+             << (follower.IsUsingInotify() ? "." : " (polling).") << endl;
+    }
+
     // 2. Menu
     int choice;
     do
     {
+        if (follow)
+        {
+            int newRecords = follower.Poll(weatherDatabase);
+            if (newRecords > 0)
+            {
+                cout << "Loaded " << newRecords << " new weather records." << endl;
+            }
+        }
+
         weatherMenu.DisplayMenu();
         cout << "Enter your choice: ";
         cin >> choice;